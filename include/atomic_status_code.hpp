@@ -0,0 +1,342 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_ATOMIC_STATUS_CODE_HPP
+#define SYSTEM_ERROR2_ATOMIC_STATUS_CODE_HPP
+
+#include "error.hpp"
+
+#include <cstdint>  // for uintptr_t
+#include <thread>   // for yield
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>  // for _InterlockedCompareExchange128
+#endif
+
+#ifndef SYSTEM_ERROR2_HAVE_DWCAS
+/* GCC and clang only define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16 on x86-64 if
+cmpxchg16b may be used, which needs -mcx16 or a -march implying it. This
+project's CMake adds -mcx16 where the compiler accepts it.
+*/
+#if(defined(__x86_64__) || defined(__aarch64__)) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+//! Defined to 1 if a lock free double word compare and swap is available. Usually automatic, can be overriden.
+#define SYSTEM_ERROR2_HAVE_DWCAS 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define SYSTEM_ERROR2_HAVE_DWCAS 1
+#else
+#define SYSTEM_ERROR2_HAVE_DWCAS 0
+#endif
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // Two pointer sized words, accessed atomically as one
+  struct atomic_two_words
+  {
+    struct words
+    {
+      uintptr_t w[2];
+    };
+#if SYSTEM_ERROR2_HAVE_DWCAS && !defined(_MSC_VER)
+    static constexpr bool is_lock_free = true;
+    __extension__ typedef unsigned __int128 _dword;
+    alignas(16) _dword _v{0};
+
+    static _dword _pack(const words &x) noexcept
+    {
+      _dword ret;
+      memcpy(&ret, x.w, sizeof(ret));
+      return ret;
+    }
+    static words _unpack(_dword x) noexcept
+    {
+      words ret;
+      memcpy(ret.w, &x, sizeof(ret.w));
+      return ret;
+    }
+    // Never true, as this implementation never blocks
+    bool known_not_empty() const noexcept { return false; }
+    words load() noexcept { return _unpack(__sync_val_compare_and_swap(&_v, _dword(0), _dword(0))); }
+    bool try_compare_exchange(words &expected, const words &desired) noexcept { return compare_exchange(expected, desired); }
+    bool compare_exchange(words &expected, const words &desired) noexcept
+    {
+      const _dword e = _pack(expected);
+      const _dword old = __sync_val_compare_and_swap(&_v, e, _pack(desired));
+      if(old == e)
+      {
+        return true;
+      }
+      expected = _unpack(old);
+      return false;
+    }
+#elif SYSTEM_ERROR2_HAVE_DWCAS
+    static constexpr bool is_lock_free = true;
+    alignas(16) volatile long long _v[2]{0, 0};
+
+    // Never true, as this implementation never blocks
+    bool known_not_empty() const noexcept { return false; }
+    words load() noexcept
+    {
+      words ret{{0, 0}};
+      compare_exchange(ret, ret);
+      return ret;
+    }
+    bool try_compare_exchange(words &expected, const words &desired) noexcept { return compare_exchange(expected, desired); }
+    bool compare_exchange(words &expected, const words &desired) noexcept
+    {
+      long long cmp[2];
+      memcpy(cmp, expected.w, sizeof(cmp));
+      if(_InterlockedCompareExchange128(_v, static_cast<long long>(desired.w[1]), static_cast<long long>(desired.w[0]), cmp) != 0)
+      {
+        return true;
+      }
+      memcpy(expected.w, cmp, sizeof(cmp));
+      return false;
+    }
+#else
+    /* A seqlock. Writers briefly exclude one another, readers retry if they
+    raced a writer. known_not_empty() lets a writer which would fail anyway
+    avoid waiting on another writer, and try_compare_exchange() fails rather
+    than wait.
+    */
+    static constexpr bool is_lock_free = false;
+    std::atomic<unsigned> _seq{0};
+    std::atomic<uintptr_t> _w[2];
+
+    atomic_two_words() noexcept
+    {
+      _w[0].store(0, std::memory_order_relaxed);
+      _w[1].store(0, std::memory_order_relaxed);
+    }
+    bool known_not_empty() const noexcept { return _w[0].load(std::memory_order_relaxed) != 0 || _w[1].load(std::memory_order_relaxed) != 0; }
+    words load() noexcept
+    {
+      for(;;)
+      {
+        const unsigned seq = _seq.load(std::memory_order_acquire);
+        if((seq & 1) != 0)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+        words ret{{_w[0].load(std::memory_order_relaxed), _w[1].load(std::memory_order_relaxed)}};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(_seq.load(std::memory_order_relaxed) == seq)
+        {
+          return ret;
+        }
+      }
+    }
+    bool compare_exchange(words &expected, const words &desired) noexcept
+    {
+      unsigned seq = _seq.load(std::memory_order_relaxed);
+      for(;;)
+      {
+        if((seq & 1) != 0)
+        {
+          std::this_thread::yield();
+          seq = _seq.load(std::memory_order_relaxed);
+          continue;
+        }
+        if(_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      return _locked_compare_exchange(seq, expected, desired);
+    }
+    // As compare_exchange(), but returns false without waiting if another writer is writing
+    bool try_compare_exchange(words &expected, const words &desired) noexcept
+    {
+      unsigned seq = _seq.load(std::memory_order_relaxed);
+      do
+      {
+        if((seq & 1) != 0)
+        {
+          return false;
+        }
+      } while(!_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+      return _locked_compare_exchange(seq, expected, desired);
+    }
+    bool _locked_compare_exchange(unsigned seq, words &expected, const words &desired) noexcept
+    {
+      std::atomic_thread_fence(std::memory_order_release);
+      const words current{{_w[0].load(std::memory_order_relaxed), _w[1].load(std::memory_order_relaxed)}};
+      const bool ret = current.w[0] == expected.w[0] && current.w[1] == expected.w[1];
+      if(ret)
+      {
+        _w[0].store(desired.w[0], std::memory_order_relaxed);
+        _w[1].store(desired.w[1], std::memory_order_relaxed);
+      }
+      else
+      {
+        expected = current;
+      }
+      _seq.store(seq + 2, std::memory_order_release);
+      return ret;
+    }
+#endif
+  };
+}  // namespace detail
+
+/*! An atomic slot holding a two word, move bitcopying status code such as `system_code` or `error`.
+
+Its intended use is recording the first failure from many threads running
+parts of one operation:
+
+```c++
+atomic_status_code<system_code> first_failure;
+// In each worker
+if(failed)
+  first_failure.try_set_if_empty(std::move(ec));
+// Afterwards
+system_code ec = first_failure.exchange(system_code());
+```
+
+Where a double word compare and swap is available (`SYSTEM_ERROR2_HAVE_DWCAS`),
+all operations except `exchange()` are lock free. On x86-64 with GCC or clang
+this needs `-mcx16`, which this project's CMake adds. Otherwise a seqlock is
+used, and `try_set_if_empty()` never waits: it returns false if the slot is
+full or another thread is writing to it. Racing `try_set_if_empty()`s still
+have exactly one winner, but one racing an `exchange()` may fail even though
+the slot ends up empty.
+
+Ownership transfers with the bits, so codes with non-trivial erased values
+such as those from `make_status_code_ptr()` are neither leaked nor double freed.
+`load()` returns a `clone()` of the current code. So that no clone is made of
+a value being destroyed, `exchange()` waits until no `load()` is in progress
+before returning the previous code. This is the remaining limitation: a
+continuous stream of overlapping `load()`s from other threads can delay an
+`exchange()` indefinitely, so `exchange()` is for resetting the slot once work
+has quiesced rather than for use under constant reading.
+*/
+template <class StatusCode> class atomic_status_code
+{
+  static_assert(traits::is_move_bitcopying<StatusCode>::value, "StatusCode must be move bitcopying");
+  static_assert(sizeof(StatusCode) == sizeof(detail::atomic_two_words::words), "StatusCode must be exactly two pointers in size");
+  static_assert(std::is_nothrow_default_constructible<StatusCode>::value, "StatusCode must be nothrow default constructible");
+
+  using _words = detail::atomic_two_words::words;
+  mutable detail::atomic_two_words _v;
+  mutable std::atomic<size_t> _loading{0};
+
+  static bool _is_empty(const _words &v) noexcept { return v.w[0] == 0 && v.w[1] == 0; }
+  static StatusCode _adopt(const _words &v) noexcept
+  {
+    StatusCode ret;
+    detail::bitcopy_relocate_in(ret, v.w);
+    return ret;
+  }
+
+public:
+  //! The type of status code held
+  using value_type = StatusCode;
+  //! True if all operations are lock free
+  static constexpr bool is_always_lock_free = detail::atomic_two_words::is_lock_free;
+
+  //! Default construction to empty
+  atomic_status_code() = default;
+  atomic_status_code(const atomic_status_code &) = delete;
+  atomic_status_code(atomic_status_code &&) = delete;
+  atomic_status_code &operator=(const atomic_status_code &) = delete;
+  atomic_status_code &operator=(atomic_status_code &&) = delete;
+  //! Destroys any code held
+  ~atomic_status_code()
+  {
+    StatusCode discard = _adopt(_v.load());
+    (void) discard;
+  }
+
+  //! True if no code is held
+  bool empty() const noexcept { return !_v.known_not_empty() && _is_empty(_v.load()); }
+
+  /*! If no code is held, relocates `v` into this slot and returns true, leaving
+  `v` empty. Otherwise returns false, leaving `v` untouched.
+  */
+  bool try_set_if_empty(StatusCode &&v) noexcept
+  {
+    if(v.empty() || _v.known_not_empty())
+    {
+      return false;
+    }
+    _words desired, expected{{0, 0}};
+    memcpy(desired.w, static_cast<const void *>(&v), sizeof(desired.w));
+    if(!_v.try_compare_exchange(expected, desired))
+    {
+      return false;
+    }
+    // The slot now owns the bits, so forget them in `v`
+    new(&v) StatusCode();
+    return true;
+  }
+
+  //! Relocates `v` into this slot, returning the code previously held.
+  StatusCode exchange(StatusCode &&v) noexcept
+  {
+    _words desired, expected = _v.load();
+    detail::bitcopy_relocate_out(desired.w, v);
+    while(!_v.compare_exchange(expected, desired))
+    {
+    }
+    // Wait for any load() which may be cloning the previous code
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while(_loading.load(std::memory_order_seq_cst) != 0)
+    {
+      std::this_thread::yield();
+    }
+    return _adopt(expected);
+  }
+
+  //! Returns a clone of the code currently held, which may be empty.
+  StatusCode load() const
+  {
+    _loading.fetch_add(1, std::memory_order_seq_cst);
+    struct guard
+    {
+      std::atomic<size_t> &loading;
+      ~guard() { loading.fetch_sub(1, std::memory_order_release); }
+    } g{_loading};
+    const _words current = _v.load();
+    if(_is_empty(current))
+    {
+      return StatusCode();
+    }
+    StatusCode borrowed = _adopt(current);
+    StatusCode ret(borrowed.clone());
+    // We only borrowed the bits, so forget them without destroying the value
+    new(&borrowed) StatusCode();
+    return ret;
+  }
+};
+
+//! An atomic `system_code`.
+using atomic_system_code = atomic_status_code<system_code>;
+//! An atomic `error`.
+using atomic_error = atomic_status_code<error>;
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
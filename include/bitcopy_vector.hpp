@@ -0,0 +1,250 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_BITCOPY_VECTOR_HPP
+#define SYSTEM_ERROR2_BITCOPY_VECTOR_HPP
+
+#include "config.hpp"
+
+#include <cstddef>  // for max_align_t
+#include <cstdlib>  // for realloc
+#include <new>      // for bad_alloc
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! A vector of bitcopy relocatable objects, such as `system_code`, `error` and
+`result<T>` where `T` is bitcopy relocatable.
+
+As `traits::is_bitcopy_relocatable<T>` guarantees that `T` may be relocated by
+copying its bits, growth is a `realloc()`, and erasure a `memmove()` of the
+items after those erased, so no move constructors nor destructors are run on
+either. Destruction is done in bulk, and for erased status codes whose domain
+sets `status_code_domain::flag_trivially_erasable` calls nothing at all.
+
+Like `system_code`, this vector is move only.
+*/
+template <class T> class bitcopy_vector
+{
+  static_assert(traits::is_bitcopy_relocatable<T>::value, "T must be bitcopy relocatable");
+  static_assert(alignof(T) <= alignof(std::max_align_t), "T must not be over aligned");
+
+  T *_begin{nullptr};
+  size_t _size{0}, _capacity{0};
+
+  static void _destroy(T *first, T *last) noexcept
+  {
+    for(; first != last; ++first)
+    {
+      detail::bulk_destroy<T>::destroy(*first);
+    }
+  }
+  bool _try_reallocate(size_t capacity) noexcept
+  {
+    if(capacity == 0)
+    {
+      // realloc() of zero bytes may or may not free, and may return a non-null pointer
+      free(static_cast<void *>(_begin));  // NOLINT
+      _begin = nullptr;
+      _capacity = 0;
+      return true;
+    }
+    if(capacity > static_cast<size_t>(-1) / sizeof(T))
+    {
+      return false;
+    }
+    auto *p = static_cast<T *>(realloc(static_cast<void *>(_begin), capacity * sizeof(T)));  // NOLINT
+    if(p == nullptr)
+    {
+      return false;
+    }
+    _begin = p;
+    _capacity = capacity;
+    return true;
+  }
+  SYSTEM_ERROR2_NORETURN static void _allocation_failed()
+  {
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+    throw std::bad_alloc();
+#else
+    SYSTEM_ERROR2_FATAL("bitcopy_vector failed to allocate memory");
+    abort();
+#endif
+  }
+  void _reallocate(size_t capacity)
+  {
+    if(!_try_reallocate(capacity))
+    {
+      _allocation_failed();
+    }
+  }
+
+public:
+  //! The type of item stored
+  using value_type = T;
+  //! The type of size
+  using size_type = size_t;
+  //! The type of iterator
+  using iterator = T *;
+  //! The type of const iterator
+  using const_iterator = const T *;
+
+  //! Constructs an empty vector, which does not allocate
+  bitcopy_vector() = default;
+  //! Copy constructor
+  bitcopy_vector(const bitcopy_vector &) = delete;
+  //! Move constructor
+  bitcopy_vector(bitcopy_vector &&o) noexcept
+      : _begin(o._begin)
+      , _size(o._size)
+      , _capacity(o._capacity)
+  {
+    o._begin = nullptr;
+    o._size = o._capacity = 0;
+  }
+  //! Copy assignment
+  bitcopy_vector &operator=(const bitcopy_vector &) = delete;
+  //! Move assignment
+  bitcopy_vector &operator=(bitcopy_vector &&o) noexcept
+  {
+    if(this != &o)
+    {
+      this->~bitcopy_vector();
+      new(this) bitcopy_vector(static_cast<bitcopy_vector &&>(o));
+    }
+    return *this;
+  }
+  ~bitcopy_vector()
+  {
+    _destroy(_begin, _begin + _size);
+    free(_begin);  // NOLINT
+  }
+
+  //! True if there are no items
+  bool empty() const noexcept { return _size == 0; }
+  //! The number of items
+  size_type size() const noexcept { return _size; }
+  //! The number of items which can be stored before reallocating
+  size_type capacity() const noexcept { return _capacity; }
+
+  //! Pointer to the first item
+  T *data() noexcept { return _begin; }
+  //! Pointer to the first item
+  const T *data() const noexcept { return _begin; }
+  //! Iterator to the first item
+  iterator begin() noexcept { return _begin; }
+  //! Iterator to the first item
+  const_iterator begin() const noexcept { return _begin; }
+  //! Iterator to after the last item
+  iterator end() noexcept { return _begin + _size; }
+  //! Iterator to after the last item
+  const_iterator end() const noexcept { return _begin + _size; }
+  //! Item at index `i`, which must be less than `size()`
+  T &operator[](size_type i) noexcept { return _begin[i]; }
+  //! Item at index `i`, which must be less than `size()`
+  const T &operator[](size_type i) const noexcept { return _begin[i]; }
+  //! The first item, of which there must be one
+  T &front() noexcept { return _begin[0]; }
+  //! The first item, of which there must be one
+  const T &front() const noexcept { return _begin[0]; }
+  //! The last item, of which there must be one
+  T &back() noexcept { return _begin[_size - 1]; }
+  //! The last item, of which there must be one
+  const T &back() const noexcept { return _begin[_size - 1]; }
+
+  //! Ensures that at least `n` items can be stored before reallocating
+  void reserve(size_type n)
+  {
+    if(n > _capacity)
+    {
+      _reallocate(n);
+    }
+  }
+  //! Reduces the capacity to the number of items
+  void shrink_to_fit()
+  {
+    if(_capacity > _size)
+    {
+      _reallocate(_size);
+    }
+  }
+
+  //! Constructs an item from `args` at the end, returning it
+  template <class... Args> T &emplace_back(Args &&... args)
+  {
+    if(_size < _capacity)
+    {
+      return *new(_begin + _size++) T(static_cast<Args &&>(args)...);
+    }
+    // `args` may refer to our items, so construct before reallocating, then relocate
+    alignas(T) unsigned char item[sizeof(T)];
+    new(item) T(static_cast<Args &&>(args)...);
+    if(!_try_reallocate((_capacity < 4) ? 4 : (_capacity > static_cast<size_t>(-1) / 2) ? static_cast<size_t>(-1) : (_capacity * 2)))
+    {
+      reinterpret_cast<T *>(item)->~T();  // NOLINT
+      _allocation_failed();
+    }
+    memcpy(static_cast<void *>(_begin + _size), item, sizeof(T));
+    return _begin[_size++];
+  }
+  //! Moves `v` onto the end
+  void push_back(T &&v) { emplace_back(static_cast<T &&>(v)); }
+  //! Destroys the last item, of which there must be one
+  void pop_back() noexcept
+  {
+    --_size;
+    _destroy(_begin + _size, _begin + _size + 1);
+  }
+
+  //! Destroys the items from `first` up to `last`, returning an iterator to the item which followed them
+  iterator erase(const_iterator first, const_iterator last) noexcept
+  {
+    T *f = _begin + (first - _begin), *l = _begin + (last - _begin);
+    if(f != l)
+    {
+      _destroy(f, l);
+      memmove(static_cast<void *>(f), static_cast<const void *>(l), (end() - l) * sizeof(T));
+      _size -= l - f;
+    }
+    return f;
+  }
+  //! Destroys the item at `pos`, returning an iterator to the item which followed it
+  iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+  //! Destroys all items, keeping the capacity
+  void clear() noexcept
+  {
+    _destroy(_begin, _begin + _size);
+    _size = 0;
+  }
+  //! Swaps the contents with `o`
+  void swap(bitcopy_vector &o) noexcept
+  {
+    bitcopy_vector t(static_cast<bitcopy_vector &&>(o));
+    o = static_cast<bitcopy_vector &&>(*this);
+    *this = static_cast<bitcopy_vector &&>(t);
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,169 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_BITCOPYING_MPSC_QUEUE_HPP
+#define SYSTEM_ERROR2_BITCOPYING_MPSC_QUEUE_HPP
+
+#include "config.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! A bounded, lock free, multi producer single consumer queue of move bitcopying
+objects, such as `system_code` and `error`.
+
+As `traits::is_move_bitcopying<T>` guarantees that `T` may be relocated with
+`memcpy()`, pushing and popping are bit copies only. No move constructors nor
+destructors are called, and nothing is allocated after construction.
+
+The implementation is Dmitry Vyukov's bounded queue, where each cell carries a
+sequence number saying whether it is free for the producer of a given ticket or
+full for the consumer. Producers claim tickets with a compare and swap, so one
+producer stalled mid push delays the consumer at that cell only, and never
+other producers. Items from any one producer are popped in the order pushed.
+
+`try_push()` may be called concurrently from any number of threads. `try_pop()`
+and `try_pop_bulk()` must only be called by one thread at a time.
+*/
+template <class T, size_t Capacity> class bitcopying_mpsc_queue
+{
+  static_assert(traits::is_move_bitcopying<T>::value, "T must be move bitcopying");
+  static_assert(std::is_nothrow_default_constructible<T>::value, "T must be nothrow default constructible");
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+  static constexpr size_t _mask = Capacity - 1;
+  struct _cell
+  {
+    std::atomic<size_t> seq;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+  // Keep the producers' and the consumer's ends on separate cache lines
+  alignas(64) std::atomic<size_t> _enqueue{0};
+  alignas(64) size_t _dequeue{0};
+  alignas(64) _cell _cells[Capacity];
+
+  // Relocates the item in `c` into `out`, destroying whatever `out` held, and frees the cell for the next lap
+  void _pop_cell(_cell &c, T &out) noexcept
+  {
+    out.~T();
+    new(&out) T();
+    detail::bitcopy_relocate_in(out, c.storage);
+    c.seq.store(_dequeue + Capacity, std::memory_order_release);
+    ++_dequeue;
+  }
+
+public:
+  //! The type of item queued
+  using value_type = T;
+
+  //! Constructs an empty queue
+  bitcopying_mpsc_queue() noexcept
+  {
+    for(size_t n = 0; n < Capacity; n++)
+    {
+      _cells[n].seq.store(n, std::memory_order_relaxed);
+    }
+  }
+  bitcopying_mpsc_queue(const bitcopying_mpsc_queue &) = delete;
+  bitcopying_mpsc_queue(bitcopying_mpsc_queue &&) = delete;
+  bitcopying_mpsc_queue &operator=(const bitcopying_mpsc_queue &) = delete;
+  bitcopying_mpsc_queue &operator=(bitcopying_mpsc_queue &&) = delete;
+  //! Destroys any items still queued. There must be no concurrent pushes.
+  ~bitcopying_mpsc_queue()
+  {
+    T discard;
+    while(try_pop(discard))
+    {
+    }
+  }
+
+  //! The maximum number of items which can be queued
+  static constexpr size_t capacity() noexcept { return Capacity; }
+
+  /*! Relocates `v` onto the end of the queue and returns true, leaving `v`
+  default constructed. If the queue is full, returns false leaving `v` untouched.
+  */
+  bool try_push(T &&v) noexcept
+  {
+    size_t pos = _enqueue.load(std::memory_order_relaxed);
+    _cell *c;
+    for(;;)
+    {
+      c = &_cells[pos & _mask];
+      const size_t seq = c->seq.load(std::memory_order_acquire);
+      const auto diff = static_cast<ptrdiff_t>(seq - pos);
+      if(diff == 0)
+      {
+        if(_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if(diff < 0)
+      {
+        return false;  // full
+      }
+      else
+      {
+        pos = _enqueue.load(std::memory_order_relaxed);
+      }
+    }
+    detail::bitcopy_relocate_out(c->storage, v);
+    c->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! If the queue is not empty, relocates the front item into `out` and returns true. Whatever `out` held is destroyed.
+  bool try_pop(T &out) noexcept
+  {
+    _cell &c = _cells[_dequeue & _mask];
+    if(c.seq.load(std::memory_order_acquire) != _dequeue + 1)
+    {
+      return false;
+    }
+    _pop_cell(c, out);
+    return true;
+  }
+
+  /*! Relocates up to `max` items from the front of the queue into `out[0, max)`,
+  returning how many were relocated. Whatever those elements of `out` held is destroyed.
+  */
+  size_t try_pop_bulk(T *out, size_t max) noexcept
+  {
+    size_t n = 0;
+    for(; n < max; n++)
+    {
+      _cell &c = _cells[_dequeue & _mask];
+      if(c.seq.load(std::memory_order_acquire) != _dequeue + 1)
+      {
+        break;
+      }
+      _pop_cell(c, out[n]);
+    }
+    return n;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
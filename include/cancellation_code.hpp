@@ -0,0 +1,237 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_CANCELLATION_CODE_HPP
+#define SYSTEM_ERROR2_CANCELLATION_CODE_HPP
+
+#include "quick_status_code_from_enum.hpp"
+
+#if(__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && defined(__has_include)
+#if __has_include(<stop_token>)
+#include <stop_token>
+#if defined(__cpp_lib_jthread)
+#define SYSTEM_ERROR2_HAVE_STOP_TOKEN 1
+#endif
+#endif
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+//! Why an operation was cancelled. Values from `user` upwards are free for the application.
+enum class cancellation_reason : unsigned char
+{
+  none = 0,         //!< Not cancelled, which is success
+  unspecified = 1,  //!< Cancelled for no particular reason
+  timeout = 2,      //!< Cancelled because a deadline passed
+  shutdown = 3,     //!< Cancelled because the owner is shutting down
+  superseded = 4,   //!< Cancelled because a newer request replaced it
+  user = 16         //!< The first of the application defined reasons
+};
+
+class _cancellation_code_domain;
+//! A cancellation code, carrying the reason for the cancellation inline.
+using cancellation_code = status_code<_cancellation_code_domain>;
+//! A specialisation of `status_error` for the cancellation code domain.
+using cancellation_error = status_error<_cancellation_code_domain>;
+
+namespace detail
+{
+  /* A cancellation_code packs the reason into the low byte of an intptr_t, and
+  an application defined detail into the remaining bits, so it fits into a
+  system_code and constructs as a constant.
+  */
+  constexpr int cancellation_code_shift = 8;
+  constexpr intptr_t cancellation_code_pack(cancellation_reason reason, uintptr_t reason_detail) noexcept { return static_cast<intptr_t>(static_cast<uintptr_t>(reason) | (reason_detail << cancellation_code_shift)); }
+  constexpr cancellation_reason cancellation_code_reason(intptr_t v) noexcept { return static_cast<cancellation_reason>(static_cast<uintptr_t>(v) & 0xff); }
+  constexpr uintptr_t cancellation_code_detail(intptr_t v) noexcept { return static_cast<uintptr_t>(v) >> cancellation_code_shift; }
+  constexpr errc cancellation_code_to_errc(intptr_t v) noexcept
+  {
+    return (cancellation_code_reason(v) == cancellation_reason::none) ? errc::success : (cancellation_code_reason(v) == cancellation_reason::timeout) ? errc::timed_out : errc::operation_canceled;
+  }
+  // A timeout is also a cancellation, so is equivalent to both.
+  constexpr bool cancellation_code_equivalent(intptr_t v, errc c) noexcept { return cancellation_code_to_errc(v) == c || (c == errc::operation_canceled && cancellation_code_reason(v) == cancellation_reason::timeout); }
+}  // namespace detail
+
+namespace mixins
+{
+  template <class Base> struct mixin<Base, _cancellation_code_domain> : public Base
+  {
+    using Base::Base;
+
+    //! Returns why the operation was cancelled.
+    constexpr cancellation_reason reason() const noexcept { return detail::cancellation_code_reason(this->value()); }
+    //! Returns the application defined detail supplied with the reason, or zero if there is none.
+    constexpr uintptr_t reason_detail() const noexcept { return detail::cancellation_code_detail(this->value()); }
+
+#ifdef SYSTEM_ERROR2_HAVE_STOP_TOKEN
+    /*! (C++ 20) Returns a cancellation code for `reason` if stop has been requested
+    on `token`, otherwise a successful code.
+    */
+    static cancellation_code from_stop_token(const std::stop_token &token, cancellation_reason reason = cancellation_reason::unspecified, uintptr_t reason_detail = 0) noexcept;
+#endif
+  };
+}  // namespace mixins
+
+/*! The implementation of the domain for cancellation codes.
+
+Cancellation is usually the most frequent failure a program sees, so these
+codes never allocate: the reason and any application defined detail are packed
+into the value, messages are static strings, and `make_status_code()` is
+`constexpr`. A cancellation code is equivalent to `errc::operation_canceled`,
+and if the reason is `cancellation_reason::timeout` also to `errc::timed_out`.
+Comparing a `cancellation_code` with an `errc` does not call into the domain.
+ */
+class _cancellation_code_domain : public status_code_domain
+{
+  template <class DomainType> friend class status_code;
+  template <class StatusCode> friend class detail::indirecting_domain;
+  using _base = status_code_domain;
+
+public:
+  //! The value type of the cancellation code, which is an `intptr_t` packing the `cancellation_reason` and its detail
+  using value_type = intptr_t;
+  using _base::string_ref;
+
+  //! Default constructor
+  constexpr explicit _cancellation_code_domain(typename _base::unique_id_type id = 0x3b5d7e9c1f2a4608) noexcept
+      : _base(id, _base::flag_trivially_erasable)
+  {
+  }
+  _cancellation_code_domain(const _cancellation_code_domain &) = default;
+  _cancellation_code_domain(_cancellation_code_domain &&) = default;
+  _cancellation_code_domain &operator=(const _cancellation_code_domain &) = default;
+  _cancellation_code_domain &operator=(_cancellation_code_domain &&) = default;
+  ~_cancellation_code_domain() = default;
+
+  //! Constexpr singleton getter. Returns constexpr cancellation_code_domain variable.
+  static inline constexpr const _cancellation_code_domain &get();
+
+  virtual string_ref name() const noexcept override { return string_ref("cancellation domain"); }  // NOLINT
+protected:
+  virtual bool _do_failure(const status_code<void> &code) const noexcept override  // NOLINT
+  {
+    assert(code.domain() == *this);                                                                                                   // NOLINT
+    return detail::cancellation_code_reason(static_cast<const cancellation_code &>(code).value()) != cancellation_reason::none;  // NOLINT
+  }
+  virtual bool _do_equivalent(const status_code<void> &code1, const status_code<void> &code2) const noexcept override  // NOLINT
+  {
+    assert(code1.domain() == *this);                                 // NOLINT
+    const auto &c1 = static_cast<const cancellation_code &>(code1);  // NOLINT
+    if(code2.domain() == *this)
+    {
+      const auto &c2 = static_cast<const cancellation_code &>(code2);  // NOLINT
+      return c1.value() == c2.value();
+    }
+    if(code2.domain() == generic_code_domain)
+    {
+      const auto &c2 = static_cast<const generic_code &>(code2);  // NOLINT
+      return detail::cancellation_code_equivalent(c1.value(), c2.value());
+    }
+    return false;
+  }
+  virtual generic_code _generic_code(const status_code<void> &code) const noexcept override  // NOLINT
+  {
+    assert(code.domain() == *this);                                // NOLINT
+    const auto &c = static_cast<const cancellation_code &>(code);  // NOLINT
+    return generic_code(detail::cancellation_code_to_errc(c.value()));
+  }
+  virtual string_ref _do_message(const status_code<void> &code) const noexcept override  // NOLINT
+  {
+    assert(code.domain() == *this);                                // NOLINT
+    const auto &c = static_cast<const cancellation_code &>(code);  // NOLINT
+    switch(detail::cancellation_code_reason(c.value()))
+    {
+    case cancellation_reason::none:
+      return string_ref("not cancelled");
+    case cancellation_reason::unspecified:
+      return string_ref("operation cancelled");
+    case cancellation_reason::timeout:
+      return string_ref("operation cancelled due to timeout");
+    case cancellation_reason::shutdown:
+      return string_ref("operation cancelled due to shutdown");
+    case cancellation_reason::superseded:
+      return string_ref("operation cancelled as superseded");
+    default:
+      return string_ref("operation cancelled for an application defined reason");
+    }
+  }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+  SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
+  {
+    assert(code.domain() == *this);                                // NOLINT
+    const auto &c = static_cast<const cancellation_code &>(code);  // NOLINT
+    throw status_error<_cancellation_code_domain>(c);
+  }
+#endif
+};
+//! A constexpr source variable for the cancellation code domain. Returned by `_cancellation_code_domain::get()`.
+constexpr _cancellation_code_domain cancellation_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(cancellation_code_domain);
+inline constexpr const _cancellation_code_domain &_cancellation_code_domain::get()
+{
+  return cancellation_code_domain;
+}
+
+/*! Returns a cancellation code for `reason` and the application defined `reason_detail`.
+`reason_detail` must fit into `sizeof(intptr_t) * 8 - 8` bits.
+*/
+constexpr inline cancellation_code make_status_code(cancellation_reason reason, uintptr_t reason_detail = 0) noexcept
+{
+  return cancellation_code(detail::cancellation_code_pack(reason, reason_detail));
+}
+
+//! True if the cancellation code is equivalent to `b`. Unlike the general comparison, does not call into the domain.
+constexpr inline bool operator==(const cancellation_code &a, errc b) noexcept
+{
+  return !a.empty() && detail::cancellation_code_equivalent(a.value(), b);
+}
+//! True if the cancellation code is equivalent to `a`. Unlike the general comparison, does not call into the domain.
+constexpr inline bool operator==(errc a, const cancellation_code &b) noexcept
+{
+  return !b.empty() && detail::cancellation_code_equivalent(b.value(), a);
+}
+//! True if the cancellation code is not equivalent to `b`. Unlike the general comparison, does not call into the domain.
+constexpr inline bool operator!=(const cancellation_code &a, errc b) noexcept
+{
+  return !(a == b);
+}
+//! True if the cancellation code is not equivalent to `a`. Unlike the general comparison, does not call into the domain.
+constexpr inline bool operator!=(errc a, const cancellation_code &b) noexcept
+{
+  return !(a == b);
+}
+
+#ifdef SYSTEM_ERROR2_HAVE_STOP_TOKEN
+namespace mixins
+{
+  template <class Base> inline cancellation_code mixin<Base, _cancellation_code_domain>::from_stop_token(const std::stop_token &token, cancellation_reason reason, uintptr_t reason_detail) noexcept
+  {
+    return token.stop_requested() ? make_status_code(reason, reason_detail) : make_status_code(cancellation_reason::none);
+  }
+}  // namespace mixins
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
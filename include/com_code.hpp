@@ -25,21 +25,37 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef SYSTEM_ERROR2_COM_CODE_HPP
 #define SYSTEM_ERROR2_COM_CODE_HPP
 
-#if !defined(_WIN32) && !defined(STANDARDESE_IS_IN_THE_HOUSE)
-#error This file should only be included on Windows
-#endif
-
 #include "nt_code.hpp"
 #include "win32_code.hpp"
 
-#ifndef STANDARDESE_IS_IN_THE_HOUSE
+#if defined(_WIN32) && !defined(STANDARDESE_IS_IN_THE_HOUSE)
 #include <comdef.h>
 #endif
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
+//! \exclude
+namespace win32
+{
+#ifdef _WIN32
+  // A COM HRESULT
+  using HRESULT = ::HRESULT;
+#else
+  // A COM HRESULT, as found in codes reported by Windows machines
+  using HRESULT = int32_t;
+#endif
+  // The bit set in a HRESULT wrapping a NT kernel code, `FACILITY_NT_BIT`
+  constexpr HRESULT facility_nt_bit = 0x10000000;
+  // The facility of a HRESULT wrapping a Win32 code, `FACILITY_WIN32`
+  constexpr uint32_t facility_win32 = 7;
+  // The facility of a HRESULT, `HRESULT_FACILITY()`
+  constexpr uint32_t hresult_facility(HRESULT c) noexcept { return (static_cast<uint32_t>(c) >> 16) & 0x1fff; }
+  // The code of a HRESULT, `HRESULT_CODE()`
+  constexpr DWORD hresult_code(HRESULT c) noexcept { return static_cast<DWORD>(static_cast<uint32_t>(c) & 0xffff); }
+}  // namespace win32
+
 class _com_code_domain;
-/*! (Windows only) A COM error code. Note semantic equivalence testing is only implemented for `FACILITY_WIN32`
+/*! A COM error code. Note semantic equivalence testing is only implemented for `FACILITY_WIN32`
 and `FACILITY_NT_BIT`. As you can see at [https://blogs.msdn.microsoft.com/eldar/2007/04/03/a-lot-of-hresult-codes/](https://blogs.msdn.microsoft.com/eldar/2007/04/03/a-lot-of-hresult-codes/),
 there are an awful lot of COM error codes, and keeping mapping tables for all of them would be impractical
 (for the Win32 and NT facilities, we actually reuse the mapping tables in `win32_code` and `nt_code`).
@@ -47,10 +63,13 @@ You can, of course, inherit your own COM code domain from this one and override
 to add semantic equivalence testing for whichever extra COM codes that your application specifically needs.
 */
 using com_code = status_code<_com_code_domain>;
-//! (Windows only) A specialisation of `status_error` for the COM error code domain.
+//! A specialisation of `status_error` for the COM error code domain.
 using com_error = status_error<_com_code_domain>;
 
-/*! (Windows only) The implementation of the domain for COM error codes and/or `IErrorInfo`.
+/*! The implementation of the domain for COM error codes and/or `IErrorInfo`.
+
+On platforms other than Windows, this domain decodes COM error codes reported
+by Windows machines, with messages from compact embedded tables.
 */
 class _com_code_domain : public status_code_domain
 {
@@ -58,6 +77,21 @@ class _com_code_domain : public status_code_domain
   template <class StatusCode> friend class detail::indirecting_domain;
   using _base = status_code_domain;
 
+#ifndef _WIN32
+  //! Construct from a `HRESULT` error code
+  static _base::string_ref _make_string_ref(win32::HRESULT c) noexcept
+  {
+    if((c & win32::facility_nt_bit) != 0)
+    {
+      return detail::win32_code_embedded_message(detail::nt_code_message(static_cast<uint32_t>(c & ~win32::facility_nt_bit)), "unknown COM code ", static_cast<uint32_t>(c));
+    }
+    if(win32::hresult_facility(c) == win32::facility_win32)
+    {
+      return detail::win32_code_embedded_message(detail::win32_code_message(win32::hresult_code(c)), "unknown COM code ", static_cast<uint32_t>(c));
+    }
+    return detail::win32_code_embedded_message(detail::com_code_message(static_cast<uint32_t>(c)), "unknown COM code ", static_cast<uint32_t>(c));
+  }
+#else
   //! Construct from a `HRESULT` error code
   static _base::string_ref _make_string_ref(HRESULT c, IErrorInfo *perrinfo = nullptr) noexcept
   {
@@ -113,15 +147,16 @@ class _com_code_domain : public status_code_domain
     return _base::atomic_refcounted_string_ref(p, end - p);
 #endif
   }
+#endif
 
 public:
-  //! The value type of the COM code, which is a `HRESULT`
-  using value_type = HRESULT;
+  //! The value type of the COM code, which is a `win32::HRESULT`
+  using value_type = win32::HRESULT;
   using _base::string_ref;
 
 public:
   //! Default constructor
-  constexpr explicit _com_code_domain(typename _base::unique_id_type id = 0xdc8275428b4effac) noexcept : _base(id) {}
+  constexpr explicit _com_code_domain(typename _base::unique_id_type id = 0xdc8275428b4effac) noexcept : _base(id, _base::flag_trivially_erasable) {}
   _com_code_domain(const _com_code_domain &) = default;
   _com_code_domain(_com_code_domain &&) = default;
   _com_code_domain &operator=(const _com_code_domain &) = default;
@@ -149,12 +184,12 @@ protected:
       const auto &c2 = static_cast<const com_code &>(code2);  // NOLINT
       return c1.value() == c2.value();
     }
-    if((c1.value() & FACILITY_NT_BIT) != 0)
+    if((c1.value() & win32::facility_nt_bit) != 0)
     {
       if(code2.domain() == nt_code_domain)
       {
         const auto &c2 = static_cast<const nt_code &>(code2);  // NOLINT
-        if(c2.value() == (c1.value() & ~FACILITY_NT_BIT))
+        if(c2.value() == (c1.value() & ~win32::facility_nt_bit))
         {
           return true;
         }
@@ -162,18 +197,18 @@ protected:
       else if(code2.domain() == generic_code_domain)
       {
         const auto &c2 = static_cast<const generic_code &>(code2);  // NOLINT
-        if(static_cast<int>(c2.value()) == _nt_code_domain::_nt_code_to_errno(c1.value() & ~FACILITY_NT_BIT))
+        if(static_cast<int>(c2.value()) == _nt_code_domain::_nt_code_to_errno(c1.value() & ~win32::facility_nt_bit))
         {
           return true;
         }
       }
     }
-    else if(HRESULT_FACILITY(c1.value()) == FACILITY_WIN32)
+    else if(win32::hresult_facility(c1.value()) == win32::facility_win32)
     {
       if(code2.domain() == win32_code_domain)
       {
         const auto &c2 = static_cast<const win32_code &>(code2);  // NOLINT
-        if(c2.value() == HRESULT_CODE(c1.value()))
+        if(c2.value() == win32::hresult_code(c1.value()))
         {
           return true;
         }
@@ -181,7 +216,7 @@ protected:
       else if(code2.domain() == generic_code_domain)
       {
         const auto &c2 = static_cast<const generic_code &>(code2);  // NOLINT
-        if(static_cast<int>(c2.value()) == _win32_code_domain::_win32_code_to_errno(HRESULT_CODE(c1.value())))
+        if(static_cast<int>(c2.value()) == _win32_code_domain::_win32_code_to_errno(win32::hresult_code(c1.value())))
         {
           return true;
         }
@@ -193,17 +228,17 @@ protected:
   {
     assert(code.domain() == *this);
     const auto &c1 = static_cast<const com_code &>(code);  // NOLINT
-    if(c1.value() == S_OK)
+    if(c1.value() == 0 /*S_OK*/)
     {
       return generic_code(errc::success);
     }
-    if((c1.value() & FACILITY_NT_BIT) != 0)
+    if((c1.value() & win32::facility_nt_bit) != 0)
     {
-      return generic_code(static_cast<errc>(_nt_code_domain::_nt_code_to_errno(c1.value() & ~FACILITY_NT_BIT)));
+      return generic_code(static_cast<errc>(_nt_code_domain::_nt_code_to_errno(c1.value() & ~win32::facility_nt_bit)));
     }
-    if(HRESULT_FACILITY(c1.value()) == FACILITY_WIN32)
+    if(win32::hresult_facility(c1.value()) == win32::facility_win32)
     {
-      return generic_code(static_cast<errc>(_win32_code_domain::_win32_code_to_errno(HRESULT_CODE(c1.value()))));
+      return generic_code(static_cast<errc>(_win32_code_domain::_win32_code_to_errno(win32::hresult_code(c1.value()))));
     }
     return generic_code(errc::unknown);
   }
@@ -222,8 +257,9 @@ protected:
   }
 #endif
 };
-//! (Windows only) A constexpr source variable for the COM code domain. Returned by `_com_code_domain::get()`.
+//! A constexpr source variable for the COM code domain. Returned by `_com_code_domain::get()`.
 constexpr _com_code_domain com_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(com_code_domain);
 inline constexpr const _com_code_domain &_com_code_domain::get()
 {
   return com_code_domain;
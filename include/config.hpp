@@ -29,6 +29,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include <cassert>
 #include <cstddef>  // for size_t
 #include <cstdlib>  // for free
+#include <cstring>  // for memcpy
 
 // 0.22
 #include <type_traits>
@@ -118,6 +119,27 @@ http://www.boost.org/LICENSE_1_0.txt)
 #endif
 #endif
 
+#ifndef SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma section(".se2dom$a", read)
+#pragma section(".se2dom$m", read)
+#pragma section(".se2dom$z", read)
+//! Places a variable into the linker section holding the domain registry. Usually automatic, can be overriden.
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY __declspec(allocate(".se2dom$m"))
+#elif defined(__APPLE__)
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY __attribute__((used, section("__DATA,__se2_domains")))
+#elif defined(__ELF__)
+#if defined(__has_attribute)
+#if __has_attribute(retain)
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY __attribute__((used, retain, section("system_error2_domains")))
+#endif
+#endif
+#ifndef SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY __attribute__((used, section("system_error2_domains")))
+#endif
+#endif
+#endif
+
 #ifndef SYSTEM_ERROR2_NAMESPACE
 //! The system_error2 namespace name.
 #define SYSTEM_ERROR2_NAMESPACE system_error2
@@ -145,6 +167,16 @@ namespace traits
   {
     static constexpr bool value = std::is_trivially_copyable<T>::value;
   };
+  /*! Specialise to true if you guarantee that a type can be relocated by copying
+  its bits to new storage, after which the old storage is abandoned without running
+  its destructor. Unlike move bitcopying, this does not require the type to be
+  default constructible. All move bitcopying types are bitcopy relocatable, and
+  that is the unspecialised implementation.
+  */
+  template <class T> struct is_bitcopy_relocatable
+  {
+    static constexpr bool value = is_move_bitcopying<T>::value;
+  };
 }  // namespace traits
 
 namespace detail
@@ -283,6 +315,32 @@ namespace detail
   {
     return bit_cast<To>(padded_erasure_object<From, sizeof(To) - sizeof(From)>{from});
   }
+
+  /* Relocates a move bitcopying object out of `src` into the raw storage at
+  `dst`, leaving `src` default constructed. The destructor is not run on the
+  moved out state, as being move bitcopying ownership moved with the bits.
+  */
+  template <class T> inline void bitcopy_relocate_out(void *dst, T &src) noexcept
+  {
+    static_assert(traits::is_move_bitcopying<T>::value, "T must be move bitcopying");
+    memcpy(dst, static_cast<const void *>(&src), sizeof(T));
+    new(&src) T();
+  }
+  /* The reverse of bitcopy_relocate_out(), relocating the bits of an object at
+  `src` into the default constructed `dst`, which takes ownership of them.
+  */
+  template <class T> inline void bitcopy_relocate_in(T &dst, const void *src) noexcept
+  {
+    static_assert(traits::is_move_bitcopying<T>::value, "T must be move bitcopying");
+    memcpy(static_cast<void *>(&dst), src, sizeof(T));
+  }
+  /* Destroys an object as part of destroying many at once. Status codes
+  specialise this to skip calling into domains whose erased destroy does nothing.
+  */
+  template <class T> struct bulk_destroy
+  {
+    static void destroy(T &v) noexcept { v.~T(); }
+  };
 }  // namespace detail
 SYSTEM_ERROR2_NAMESPACE_END
 
@@ -0,0 +1,16 @@
+// Generated by utils/generate-tables.cpp from utils/data/com_code_messages.txt, do not edit
+{0x0, "S_OK: The operation completed successfully."},
+{0x1, "S_FALSE: The operation completed successfully, but returned false."},
+{0x8000000e, "E_ILLEGAL_METHOD_CALL: A method was called at an unexpected time."},
+{0x80000013, "RO_E_CLOSED: The object has been closed."},
+{0x80004001, "E_NOTIMPL: Not implemented."},
+{0x80004002, "E_NOINTERFACE: No such interface supported."},
+{0x80004003, "E_POINTER: Invalid pointer."},
+{0x80004004, "E_ABORT: Operation aborted."},
+{0x80004005, "E_FAIL: Unspecified error."},
+{0x8000ffff, "E_UNEXPECTED: Catastrophic failure."},
+{0x80010106, "RPC_E_CHANGED_MODE: Cannot change thread mode after it is set."},
+{0x8001010e, "RPC_E_WRONG_THREAD: The application called an interface that was marshalled for a different thread."},
+{0x80040111, "CLASS_E_CLASSNOTAVAILABLE: ClassFactory cannot supply requested class."},
+{0x80040154, "REGDB_E_CLASSNOTREG: Class not registered."},
+{0x800401f0, "CO_E_NOTINITIALIZED: CoInitialize has not been called."},
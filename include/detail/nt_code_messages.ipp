@@ -0,0 +1,44 @@
+// Generated by utils/generate-tables.cpp from utils/data/nt_code_messages.txt, do not edit
+{0x0, "STATUS_SUCCESS: The operation completed successfully."},
+{0x102, "STATUS_TIMEOUT: The wait operation timed out."},
+{0x103, "STATUS_PENDING: The operation that was requested is pending completion."},
+{0x80000005, "STATUS_BUFFER_OVERFLOW: The data was too large to fit into the specified buffer."},
+{0x80000006, "STATUS_NO_MORE_FILES: No more files were found which match the file specification."},
+{0x8000001a, "STATUS_NO_MORE_ENTRIES: No more entries are available from an enumeration operation."},
+{0xc0000001, "STATUS_UNSUCCESSFUL: The requested operation was unsuccessful."},
+{0xc0000002, "STATUS_NOT_IMPLEMENTED: The requested operation is not implemented."},
+{0xc0000005, "STATUS_ACCESS_VIOLATION: An invalid memory access occurred."},
+{0xc0000008, "STATUS_INVALID_HANDLE: An invalid handle was specified."},
+{0xc000000d, "STATUS_INVALID_PARAMETER: An invalid parameter was passed to a service or function."},
+{0xc000000f, "STATUS_NO_SUCH_FILE: The file does not exist."},
+{0xc0000010, "STATUS_INVALID_DEVICE_REQUEST: The specified request is not a valid operation for the target device."},
+{0xc0000011, "STATUS_END_OF_FILE: The end-of-file marker has been reached."},
+{0xc0000017, "STATUS_NO_MEMORY: Not enough virtual memory or paging file quota is available to complete the specified operation."},
+{0xc000001d, "STATUS_ILLEGAL_INSTRUCTION: An attempt was made to execute an illegal instruction."},
+{0xc0000022, "STATUS_ACCESS_DENIED: A process has requested access to an object but has not been granted those access rights."},
+{0xc0000023, "STATUS_BUFFER_TOO_SMALL: The buffer is too small to contain the entry."},
+{0xc0000033, "STATUS_OBJECT_NAME_INVALID: The object name is invalid."},
+{0xc0000034, "STATUS_OBJECT_NAME_NOT_FOUND: The object name is not found."},
+{0xc0000035, "STATUS_OBJECT_NAME_COLLISION: The object name already exists."},
+{0xc000003a, "STATUS_OBJECT_PATH_NOT_FOUND: The path does not exist."},
+{0xc0000043, "STATUS_SHARING_VIOLATION: A file cannot be opened because the share access flags are incompatible."},
+{0xc0000054, "STATUS_FILE_LOCK_CONFLICT: A requested read/write cannot be granted due to a conflicting file lock."},
+{0xc0000056, "STATUS_DELETE_PENDING: A non-close operation has been requested of a file object that has a delete pending."},
+{0xc000007f, "STATUS_DISK_FULL: An operation failed because the disk was full."},
+{0xc0000094, "STATUS_INTEGER_DIVIDE_BY_ZERO: An integer divide by zero occurred."},
+{0xc000009a, "STATUS_INSUFFICIENT_RESOURCES: Insufficient system resources exist to complete the API."},
+{0xc00000b5, "STATUS_IO_TIMEOUT: The specified I/O operation was not completed before the time-out period expired."},
+{0xc00000ba, "STATUS_FILE_IS_A_DIRECTORY: The file that was specified as a target is a directory."},
+{0xc00000bb, "STATUS_NOT_SUPPORTED: The request is not supported."},
+{0xc00000fd, "STATUS_STACK_OVERFLOW: A new guard page for the stack cannot be created."},
+{0xc0000101, "STATUS_DIRECTORY_NOT_EMPTY: The directory is not empty."},
+{0xc0000103, "STATUS_NOT_A_DIRECTORY: A requested opened file is not a directory."},
+{0xc0000120, "STATUS_CANCELLED: The I/O request was canceled."},
+{0xc0000135, "STATUS_DLL_NOT_FOUND: The code execution cannot proceed because a required DLL was not found."},
+{0xc0000139, "STATUS_ENTRYPOINT_NOT_FOUND: The procedure entry point could not be located."},
+{0xc0000142, "STATUS_DLL_INIT_FAILED: A DLL initialization routine failed."},
+{0xc000020d, "STATUS_CONNECTION_RESET: The transport connection was reset."},
+{0xc0000236, "STATUS_CONNECTION_REFUSED: The transport connection attempt was refused by the remote system."},
+{0xc000023c, "STATUS_NETWORK_UNREACHABLE: The remote network is not reachable by the transport."},
+{0xc0000374, "STATUS_HEAP_CORRUPTION: A heap has been corrupted."},
+{0xc0000409, "STATUS_STACK_BUFFER_OVERRUN: The system detected an overrun of a stack-based buffer in this application."},
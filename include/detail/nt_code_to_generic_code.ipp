@@ -1,98 +1,99 @@
-case 0x80000002: return EACCES;
-case 0x8000000f: return EAGAIN;
-case 0x80000010: return EAGAIN;
-case 0x80000011: return EBUSY;
-case 0xc0000002: return ENOSYS;
-case 0xc0000005: return EACCES;
-case 0xc0000008: return EINVAL;
-case 0xc000000e: return ENOENT;
-case 0xc000000f: return ENOENT;
-case 0xc0000010: return ENOSYS;
-case 0xc0000013: return EAGAIN;
-case 0xc0000017: return ENOMEM;
-case 0xc000001c: return ENOSYS;
-case 0xc000001e: return EACCES;
-case 0xc000001f: return EACCES;
-case 0xc0000021: return EACCES;
-case 0xc0000022: return EACCES;
-case 0xc0000024: return EINVAL;
-case 0xc0000033: return EINVAL;
-case 0xc0000034: return ENOENT;
-case 0xc0000035: return EEXIST;
-case 0xc0000037: return EINVAL;
-case 0xc000003a: return ENOENT;
-case 0xc0000040: return ENOMEM;
-case 0xc0000041: return EACCES;
-case 0xc0000042: return EINVAL;
-case 0xc0000043: return EACCES;
-case 0xc000004b: return EACCES;
-case 0xc0000054: return ENOLCK;
-case 0xc0000055: return ENOLCK;
-case 0xc0000056: return EACCES;
-case 0xc000007f: return ENOSPC;
-case 0xc0000087: return ENOMEM;
-case 0xc0000097: return ENOMEM;
-case 0xc000009b: return ENOENT;
-case 0xc000009e: return EAGAIN;
-case 0xc00000a2: return EACCES;
-case 0xc00000a3: return EAGAIN;
-case 0xc00000af: return ENOSYS;
-case 0xc00000ba: return EACCES;
-case 0xc00000c0: return ENODEV;
-case 0xc00000d4: return EXDEV;
-case 0xc00000d5: return EACCES;
-case 0xc00000fb: return ENOENT;
-case 0xc0000101: return ENOTEMPTY;
-case 0xc0000103: return EINVAL;
-case 0xc0000107: return EBUSY;
-case 0xc0000108: return EBUSY;
-case 0xc000010a: return EACCES;
-case 0xc000011f: return EMFILE;
-case 0xc0000120: return ECANCELED;
-case 0xc0000121: return EACCES;
-case 0xc0000123: return EACCES;
-case 0xc0000128: return EINVAL;
-case 0xc0000189: return EACCES;
-case 0xc00001ad: return ENOMEM;
-case 0xc000022d: return EAGAIN;
-case 0xc0000235: return EINVAL;
-case 0xc000026e: return EAGAIN;
-case 0xc000028a: return EACCES;
-case 0xc000028b: return EACCES;
-case 0xc000028d: return EACCES;
-case 0xc000028e: return EACCES;
-case 0xc000028f: return EACCES;
-case 0xc0000290: return EACCES;
-case 0xc000029c: return ENOSYS;
-case 0xc00002c5: return EACCES;
-case 0xc00002d3: return EAGAIN;
-case 0xc00002ea: return EACCES;
-case 0xc00002f0: return ENOENT;
-case 0xc0000373: return ENOMEM;
-case 0xc0000416: return ENOMEM;
-case 0xc0000433: return EBUSY;
-case 0xc0000434: return EBUSY;
-case 0xc0000455: return EINVAL;
-case 0xc0000467: return EACCES;
-case 0xc0000491: return ENOENT;
-case 0xc0000495: return EAGAIN;
-case 0xc0000503: return EAGAIN;
-case 0xc0000507: return EBUSY;
-case 0xc0000512: return EACCES;
-case 0xc000070a: return EINVAL;
-case 0xc000070b: return EINVAL;
-case 0xc000070c: return EINVAL;
-case 0xc000070d: return EINVAL;
-case 0xc000070e: return EINVAL;
-case 0xc000070f: return EINVAL;
-case 0xc0000710: return ENOSYS;
-case 0xc0000711: return ENOSYS;
-case 0xc0000716: return EINVAL;
-case 0xc000071b: return ENOSYS;
-case 0xc000071d: return ENOSYS;
-case 0xc000071e: return ENOSYS;
-case 0xc000071f: return ENOSYS;
-case 0xc0000720: return ENOSYS;
-case 0xc0000721: return ENOSYS;
-case 0xc000080f: return EAGAIN;
-case 0xc000a203: return EACCES;
+// Generated by utils/generate-tables.cpp from utils/data/nt_code_to_generic_code.txt, do not edit
+{0x80000002, EACCES},
+{0x8000000f, EAGAIN},
+{0x80000010, EAGAIN},
+{0x80000011, EBUSY},
+{0xc0000002, ENOSYS},
+{0xc0000005, EACCES},
+{0xc0000008, EINVAL},
+{0xc000000e, ENOENT},
+{0xc000000f, ENOENT},
+{0xc0000010, ENOSYS},
+{0xc0000013, EAGAIN},
+{0xc0000017, ENOMEM},
+{0xc000001c, ENOSYS},
+{0xc000001e, EACCES},
+{0xc000001f, EACCES},
+{0xc0000021, EACCES},
+{0xc0000022, EACCES},
+{0xc0000024, EINVAL},
+{0xc0000033, EINVAL},
+{0xc0000034, ENOENT},
+{0xc0000035, EEXIST},
+{0xc0000037, EINVAL},
+{0xc000003a, ENOENT},
+{0xc0000040, ENOMEM},
+{0xc0000041, EACCES},
+{0xc0000042, EINVAL},
+{0xc0000043, EACCES},
+{0xc000004b, EACCES},
+{0xc0000054, ENOLCK},
+{0xc0000055, ENOLCK},
+{0xc0000056, EACCES},
+{0xc000007f, ENOSPC},
+{0xc0000087, ENOMEM},
+{0xc0000097, ENOMEM},
+{0xc000009b, ENOENT},
+{0xc000009e, EAGAIN},
+{0xc00000a2, EACCES},
+{0xc00000a3, EAGAIN},
+{0xc00000af, ENOSYS},
+{0xc00000ba, EACCES},
+{0xc00000c0, ENODEV},
+{0xc00000d4, EXDEV},
+{0xc00000d5, EACCES},
+{0xc00000fb, ENOENT},
+{0xc0000101, ENOTEMPTY},
+{0xc0000103, EINVAL},
+{0xc0000107, EBUSY},
+{0xc0000108, EBUSY},
+{0xc000010a, EACCES},
+{0xc000011f, EMFILE},
+{0xc0000120, ECANCELED},
+{0xc0000121, EACCES},
+{0xc0000123, EACCES},
+{0xc0000128, EINVAL},
+{0xc0000189, EACCES},
+{0xc00001ad, ENOMEM},
+{0xc000022d, EAGAIN},
+{0xc0000235, EINVAL},
+{0xc000026e, EAGAIN},
+{0xc000028a, EACCES},
+{0xc000028b, EACCES},
+{0xc000028d, EACCES},
+{0xc000028e, EACCES},
+{0xc000028f, EACCES},
+{0xc0000290, EACCES},
+{0xc000029c, ENOSYS},
+{0xc00002c5, EACCES},
+{0xc00002d3, EAGAIN},
+{0xc00002ea, EACCES},
+{0xc00002f0, ENOENT},
+{0xc0000373, ENOMEM},
+{0xc0000416, ENOMEM},
+{0xc0000433, EBUSY},
+{0xc0000434, EBUSY},
+{0xc0000455, EINVAL},
+{0xc0000467, EACCES},
+{0xc0000491, ENOENT},
+{0xc0000495, EAGAIN},
+{0xc0000503, EAGAIN},
+{0xc0000507, EBUSY},
+{0xc0000512, EACCES},
+{0xc000070a, EINVAL},
+{0xc000070b, EINVAL},
+{0xc000070c, EINVAL},
+{0xc000070d, EINVAL},
+{0xc000070e, EINVAL},
+{0xc000070f, EINVAL},
+{0xc0000710, ENOSYS},
+{0xc0000711, ENOSYS},
+{0xc0000716, EINVAL},
+{0xc000071b, ENOSYS},
+{0xc000071d, ENOSYS},
+{0xc000071e, ENOSYS},
+{0xc000071f, ENOSYS},
+{0xc0000720, ENOSYS},
+{0xc0000721, ENOSYS},
+{0xc000080f, EAGAIN},
+{0xc000a203, EACCES},
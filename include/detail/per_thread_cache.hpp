@@ -0,0 +1,85 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_DETAIL_PER_THREAD_CACHE_HPP
+#define SYSTEM_ERROR2_DETAIL_PER_THREAD_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /*! Remembers, for the calling thread, the per thread `T` which each of the
+  most recently used instances of `Owner` gave it, so that a thread using
+  several instances in turn need not search for its `T` each time.
+
+  Instances are identified by a number from `next_instance()`, which is never
+  zero nor reused, so an entry left by a destroyed instance never matches. The
+  cache is direct mapped, and as instance numbers are consecutive the last `N`
+  instances constructed never evict one another.
+  */
+  template <class Owner, class T, size_t N = 8> class per_thread_cache
+  {
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+    struct _entry
+    {
+      uint64_t instance;
+      T *value;
+    };
+    static _entry &_slot(uint64_t instance) noexcept
+    {
+      static thread_local _entry entries[N];
+      return entries[instance & (N - 1)];
+    }
+
+  public:
+    //! Returns a new instance number, never zero.
+    static uint64_t next_instance() noexcept
+    {
+      static std::atomic<uint64_t> count{0};
+      return ++count;
+    }
+    //! Returns the calling thread's `T` for `instance`, or null if not cached.
+    static T *find(uint64_t instance) noexcept
+    {
+      const _entry &e = _slot(instance);
+      return (instance != 0 && e.instance == instance) ? e.value : nullptr;
+    }
+    //! Caches `value` as the calling thread's `T` for `instance`.
+    static void set(uint64_t instance, T *value) noexcept
+    {
+      _entry &e = _slot(instance);
+      e.instance = instance;
+      e.value = value;
+    }
+  };
+}  // namespace detail
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,65 @@
+// Generated by utils/generate-tables.cpp from utils/data/win32_code_messages.txt, do not edit
+{0x0, "ERROR_SUCCESS: The operation completed successfully."},
+{0x1, "ERROR_INVALID_FUNCTION: Incorrect function."},
+{0x2, "ERROR_FILE_NOT_FOUND: The system cannot find the file specified."},
+{0x3, "ERROR_PATH_NOT_FOUND: The system cannot find the path specified."},
+{0x4, "ERROR_TOO_MANY_OPEN_FILES: The system cannot open the file."},
+{0x5, "ERROR_ACCESS_DENIED: Access is denied."},
+{0x6, "ERROR_INVALID_HANDLE: The handle is invalid."},
+{0x8, "ERROR_NOT_ENOUGH_MEMORY: Not enough memory resources are available to process this command."},
+{0xd, "ERROR_INVALID_DATA: The data is invalid."},
+{0xe, "ERROR_OUTOFMEMORY: Not enough memory resources are available to complete this operation."},
+{0xf, "ERROR_INVALID_DRIVE: The system cannot find the drive specified."},
+{0x11, "ERROR_NOT_SAME_DEVICE: The system cannot move the file to a different disk drive."},
+{0x12, "ERROR_NO_MORE_FILES: There are no more files."},
+{0x13, "ERROR_WRITE_PROTECT: The media is write protected."},
+{0x15, "ERROR_NOT_READY: The device is not ready."},
+{0x1f, "ERROR_GEN_FAILURE: A device attached to the system is not functioning."},
+{0x20, "ERROR_SHARING_VIOLATION: The process cannot access the file because it is being used by another process."},
+{0x21, "ERROR_LOCK_VIOLATION: The process cannot access the file because another process has locked a portion of the file."},
+{0x26, "ERROR_HANDLE_EOF: Reached the end of the file."},
+{0x27, "ERROR_HANDLE_DISK_FULL: The disk is full."},
+{0x32, "ERROR_NOT_SUPPORTED: The request is not supported."},
+{0x35, "ERROR_BAD_NETPATH: The network path was not found."},
+{0x40, "ERROR_NETNAME_DELETED: The specified network name is no longer available."},
+{0x50, "ERROR_FILE_EXISTS: The file exists."},
+{0x57, "ERROR_INVALID_PARAMETER: The parameter is incorrect."},
+{0x6d, "ERROR_BROKEN_PIPE: The pipe has been ended."},
+{0x6f, "ERROR_BUFFER_OVERFLOW: The file name is too long."},
+{0x70, "ERROR_DISK_FULL: There is not enough space on the disk."},
+{0x78, "ERROR_CALL_NOT_IMPLEMENTED: This function is not supported on this system."},
+{0x7a, "ERROR_INSUFFICIENT_BUFFER: The data area passed to a system call is too small."},
+{0x7b, "ERROR_INVALID_NAME: The filename, directory name, or volume label syntax is incorrect."},
+{0x7e, "ERROR_MOD_NOT_FOUND: The specified module could not be found."},
+{0x7f, "ERROR_PROC_NOT_FOUND: The specified procedure could not be found."},
+{0x91, "ERROR_DIR_NOT_EMPTY: The directory is not empty."},
+{0xaa, "ERROR_BUSY: The requested resource is in use."},
+{0xb7, "ERROR_ALREADY_EXISTS: Cannot create a file when that file already exists."},
+{0xcb, "ERROR_ENVVAR_NOT_FOUND: The system could not find the environment option that was entered."},
+{0xe8, "ERROR_NO_DATA: The pipe is being closed."},
+{0xea, "ERROR_MORE_DATA: More data is available."},
+{0x102, "WAIT_TIMEOUT: The wait operation timed out."},
+{0x103, "ERROR_NO_MORE_ITEMS: No more data is available."},
+{0x10b, "ERROR_DIRECTORY: The directory name is invalid."},
+{0x12b, "ERROR_PARTIAL_COPY: Only part of a ReadProcessMemory or WriteProcessMemory request was completed."},
+{0x3e3, "ERROR_OPERATION_ABORTED: The I/O operation has been aborted because of either a thread exit or an application request."},
+{0x3e4, "ERROR_IO_INCOMPLETE: Overlapped I/O event is not in a signaled state."},
+{0x3e5, "ERROR_IO_PENDING: Overlapped I/O operation is in progress."},
+{0x3e6, "ERROR_NOACCESS: Invalid access to memory location."},
+{0x4c7, "ERROR_CANCELLED: The operation was canceled by the user."},
+{0x4cf, "ERROR_NETWORK_UNREACHABLE: The network location cannot be reached."},
+{0x4d5, "ERROR_RETRY: The operation could not be completed. A retry should be performed."},
+{0x5b4, "ERROR_TIMEOUT: This operation returned because the timeout period expired."},
+{0x6ba, "RPC_S_SERVER_UNAVAILABLE: The RPC server is unavailable."},
+{0x2714, "WSAEINTR: A blocking operation was interrupted."},
+{0x2733, "WSAEWOULDBLOCK: A non-blocking socket operation could not be completed immediately."},
+{0x2740, "WSAEADDRINUSE: Only one usage of each socket address is normally permitted."},
+{0x2741, "WSAEADDRNOTAVAIL: The requested address is not valid in its context."},
+{0x2743, "WSAENETUNREACH: A socket operation was attempted to an unreachable network."},
+{0x2745, "WSAECONNABORTED: An established connection was aborted by the software in your host machine."},
+{0x2746, "WSAECONNRESET: An existing connection was forcibly closed by the remote host."},
+{0x2749, "WSAENOTCONN: The socket is not connected."},
+{0x274c, "WSAETIMEDOUT: The connection attempt timed out."},
+{0x274d, "WSAECONNREFUSED: No connection could be made because the target machine actively refused it."},
+{0x2751, "WSAEHOSTUNREACH: A socket operation was attempted to an unreachable host."},
+{0x2af9, "WSAHOST_NOT_FOUND: No such host is known."},
@@ -0,0 +1,149 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_DETAIL_WIN32_CODE_TABLES_HPP
+#define SYSTEM_ERROR2_DETAIL_WIN32_CODE_TABLES_HPP
+
+#include "../config.hpp"
+
+#include <cerrno>   // for error constants
+#include <cstdint>  // for uint32_t
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  //! An entry in a sorted table mapping one kind of system code to another.
+  struct win32_code_mapping
+  {
+    uint32_t from;
+    uint16_t to;
+  };
+  //! An entry in a sorted table mapping a system code to its message, for when `FormatMessage()` is unavailable.
+  struct win32_code_message
+  {
+    uint32_t from;
+    const char *message;
+  };
+
+  /* The NT kernel to Win32, NT kernel to POSIX and Win32 to POSIX mapping
+  tables. These are generated by utils/generate-tables.cpp from the checked in
+  data in utils/data, and are shared by the NT, Win32 and COM code domains.
+
+  Being sorted arrays, lookup is a binary search of known cost, rather than
+  whatever a given compiler chooses to emit for a thousand case sparse switch.
+  They are static data members of a template so that C++ 11 emits exactly one
+  copy of each per program, rather than one per translation unit.
+
+  The message tables are only used on platforms without `FormatMessage()`,
+  and are only emitted into the binary if used.
+  */
+  template <class T = void> struct win32_code_tables
+  {
+    static constexpr win32_code_mapping nt_code_to_win32_code[] = {
+#include "nt_code_to_win32_code.ipp"
+    };
+    static constexpr win32_code_mapping nt_code_to_generic_code[] = {
+#include "nt_code_to_generic_code.ipp"
+    };
+    static constexpr win32_code_mapping win32_code_to_generic_code[] = {
+#include "win32_code_to_generic_code.ipp"
+    };
+    static constexpr win32_code_message nt_code_messages[] = {
+#include "nt_code_messages.ipp"
+    };
+    static constexpr win32_code_message win32_code_messages[] = {
+#include "win32_code_messages.ipp"
+    };
+    static constexpr win32_code_message com_code_messages[] = {
+#include "com_code_messages.ipp"
+    };
+  };
+  template <class T> constexpr win32_code_mapping win32_code_tables<T>::nt_code_to_win32_code[];
+  template <class T> constexpr win32_code_mapping win32_code_tables<T>::nt_code_to_generic_code[];
+  template <class T> constexpr win32_code_mapping win32_code_tables<T>::win32_code_to_generic_code[];
+  template <class T> constexpr win32_code_message win32_code_tables<T>::nt_code_messages[];
+  template <class T> constexpr win32_code_message win32_code_tables<T>::win32_code_messages[];
+  template <class T> constexpr win32_code_message win32_code_tables<T>::com_code_messages[];
+
+  //! Returns the entry for `v` in the sorted `table`, or null if there is none.
+  template <class Entry, size_t N> inline const Entry *find_win32_code_mapping(const Entry (&table)[N], uint32_t v) noexcept
+  {
+    size_t lo = 0, hi = N;
+    while(lo < hi)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+      if(table[mid].from < v)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    return (lo < N && table[lo].from == v) ? &table[lo] : nullptr;
+  }
+
+  //! Returns the POSIX errno closest to a failing NT kernel code, or -1 if there is none.
+  inline int nt_code_to_errno(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::nt_code_to_generic_code, c);
+    return (m != nullptr) ? static_cast<int>(m->to) : -1;
+  }
+  //! Returns the Win32 code closest to a failing NT kernel code, or `(uint32_t) -1` if there is none.
+  inline uint32_t nt_code_to_win32_code(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::nt_code_to_win32_code, c);
+    return (m != nullptr) ? static_cast<uint32_t>(m->to) : static_cast<uint32_t>(-1);
+  }
+  //! Returns the POSIX errno closest to a failing Win32 code, or -1 if there is none.
+  inline int win32_code_to_errno(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::win32_code_to_generic_code, c);
+    return (m != nullptr) ? static_cast<int>(m->to) : -1;
+  }
+  //! Returns the embedded message for a NT kernel code, or null if there is none.
+  inline const char *nt_code_message(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::nt_code_messages, c);
+    return (m != nullptr) ? m->message : nullptr;
+  }
+  //! Returns the embedded message for a Win32 code, or null if there is none.
+  inline const char *win32_code_message(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::win32_code_messages, c);
+    return (m != nullptr) ? m->message : nullptr;
+  }
+  //! Returns the embedded message for a COM code outside `FACILITY_WIN32` and `FACILITY_NT_BIT`, or null if there is none.
+  inline const char *com_code_message(uint32_t c) noexcept
+  {
+    const auto *m = find_win32_code_mapping(win32_code_tables<>::com_code_messages, c);
+    return (m != nullptr) ? m->message : nullptr;
+  }
+}  // namespace detail
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
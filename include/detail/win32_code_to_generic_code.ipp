@@ -1,75 +1,76 @@
-case 0x1: return ENOSYS;
-case 0x2: return ENOENT;
-case 0x3: return ENOENT;
-case 0x4: return EMFILE;
-case 0x5: return EACCES;
-case 0x6: return EINVAL;
-case 0x8: return ENOMEM;
-case 0xc: return EACCES;
-case 0xe: return ENOMEM;
-case 0xf: return ENODEV;
-case 0x10: return EACCES;
-case 0x11: return EXDEV;
-case 0x13: return EACCES;
-case 0x14: return ENODEV;
-case 0x15: return EAGAIN;
-case 0x19: return EIO;
-case 0x1d: return EIO;
-case 0x1e: return EIO;
-case 0x20: return EACCES;
-case 0x21: return ENOLCK;
-case 0x27: return ENOSPC;
-case 0x37: return ENODEV;
-case 0x50: return EEXIST;
-case 0x52: return EACCES;
-case 0x57: return EINVAL;
-case 0x6e: return EIO;
-case 0x6f: return ENAMETOOLONG;
-case 0x70: return ENOSPC;
-case 0x7b: return EINVAL;
-case 0x83: return EINVAL;
-case 0x8e: return EBUSY;
-case 0x91: return ENOTEMPTY;
-case 0xaa: return EBUSY;
-case 0xb7: return EEXIST;
-case 0xd4: return ENOLCK;
-case 0x10b: return EINVAL;
-case 0x3e3: return ECANCELED;
-case 0x3e6: return EACCES;
-case 0x3f3: return EIO;
-case 0x3f4: return EIO;
-case 0x3f5: return EIO;
-case 0x4d5: return EAGAIN;
-case 0x961: return EBUSY;
-case 0x964: return EBUSY;
-case 0x2714: return EINTR;
-case 0x2719: return EBADF;
-case 0x271d: return EACCES;
-case 0x271e: return EFAULT;
-case 0x2726: return EINVAL;
-case 0x2728: return EMFILE;
-case 0x2733: return EWOULDBLOCK;
-case 0x2734: return EINPROGRESS;
-case 0x2735: return EALREADY;
-case 0x2736: return ENOTSOCK;
-case 0x2737: return EDESTADDRREQ;
-case 0x2738: return EMSGSIZE;
-case 0x2739: return EPROTOTYPE;
-case 0x273a: return ENOPROTOOPT;
-case 0x273b: return EPROTONOSUPPORT;
-case 0x273d: return EOPNOTSUPP;
-case 0x273f: return EAFNOSUPPORT;
-case 0x2740: return EADDRINUSE;
-case 0x2741: return EADDRNOTAVAIL;
-case 0x2742: return ENETDOWN;
-case 0x2743: return ENETUNREACH;
-case 0x2744: return ENETRESET;
-case 0x2745: return ECONNABORTED;
-case 0x2746: return ECONNRESET;
-case 0x2747: return ENOBUFS;
-case 0x2748: return EISCONN;
-case 0x2749: return ENOTCONN;
-case 0x274c: return ETIMEDOUT;
-case 0x274d: return ECONNREFUSED;
-case 0x274f: return ENAMETOOLONG;
-case 0x2751: return EHOSTUNREACH;
+// Generated by utils/generate-tables.cpp from utils/data/win32_code_to_generic_code.txt, do not edit
+{0x1, ENOSYS},
+{0x2, ENOENT},
+{0x3, ENOENT},
+{0x4, EMFILE},
+{0x5, EACCES},
+{0x6, EINVAL},
+{0x8, ENOMEM},
+{0xc, EACCES},
+{0xe, ENOMEM},
+{0xf, ENODEV},
+{0x10, EACCES},
+{0x11, EXDEV},
+{0x13, EACCES},
+{0x14, ENODEV},
+{0x15, EAGAIN},
+{0x19, EIO},
+{0x1d, EIO},
+{0x1e, EIO},
+{0x20, EACCES},
+{0x21, ENOLCK},
+{0x27, ENOSPC},
+{0x37, ENODEV},
+{0x50, EEXIST},
+{0x52, EACCES},
+{0x57, EINVAL},
+{0x6e, EIO},
+{0x6f, ENAMETOOLONG},
+{0x70, ENOSPC},
+{0x7b, EINVAL},
+{0x83, EINVAL},
+{0x8e, EBUSY},
+{0x91, ENOTEMPTY},
+{0xaa, EBUSY},
+{0xb7, EEXIST},
+{0xd4, ENOLCK},
+{0x10b, EINVAL},
+{0x3e3, ECANCELED},
+{0x3e6, EACCES},
+{0x3f3, EIO},
+{0x3f4, EIO},
+{0x3f5, EIO},
+{0x4d5, EAGAIN},
+{0x961, EBUSY},
+{0x964, EBUSY},
+{0x2714, EINTR},
+{0x2719, EBADF},
+{0x271d, EACCES},
+{0x271e, EFAULT},
+{0x2726, EINVAL},
+{0x2728, EMFILE},
+{0x2733, EWOULDBLOCK},
+{0x2734, EINPROGRESS},
+{0x2735, EALREADY},
+{0x2736, ENOTSOCK},
+{0x2737, EDESTADDRREQ},
+{0x2738, EMSGSIZE},
+{0x2739, EPROTOTYPE},
+{0x273a, ENOPROTOOPT},
+{0x273b, EPROTONOSUPPORT},
+{0x273d, EOPNOTSUPP},
+{0x273f, EAFNOSUPPORT},
+{0x2740, EADDRINUSE},
+{0x2741, EADDRNOTAVAIL},
+{0x2742, ENETDOWN},
+{0x2743, ENETUNREACH},
+{0x2744, ENETRESET},
+{0x2745, ECONNABORTED},
+{0x2746, ECONNRESET},
+{0x2747, ENOBUFS},
+{0x2748, EISCONN},
+{0x2749, ENOTCONN},
+{0x274c, ETIMEDOUT},
+{0x274d, ECONNREFUSED},
+{0x274f, ENAMETOOLONG},
+{0x2751, EHOSTUNREACH},
@@ -0,0 +1,456 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_EPOLL_REACTOR_HPP
+#define SYSTEM_ERROR2_EPOLL_REACTOR_HPP
+
+#include "posix_io.hpp"
+
+#if(__cplusplus >= 201703L || _HAS_CXX17) && __has_include(<variant>)
+
+#ifndef __linux__
+#error Only available on Linux
+#else
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#endif
+
+#include <cerrno>
+#include <cstring>  // for memcpy
+#include <deque>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \class epoll_reactor
+\brief A minimal edge triggered `epoll` reactor for non-blocking sockets, only available on C++ 17 or later.
+
+Sockets are registered with `add()`, which makes them non-blocking. The
+`async_*()` functions try the operation immediately, and if it would block
+queue it until `run_once()` sees the socket become ready. Operations on each
+side of a socket complete in the order started. Completion handlers receive a
+`result<T>` whose error is the `posix_code` of the failure.
+
+`EAGAIN`, `EWOULDBLOCK` and `EINTR` never reach handlers. They are tested as
+integers straight after the system call, so an operation which would block
+costs no status code, only its queueing.
+
+The batched `async_recvmmsg()` and `async_sendmmsg()` set a `posix_code` per
+message, so that one datagram failing, say with `EMSGSIZE`, does not lose
+the outcome of the others.
+
+Handlers may be called before the `async_*()` function returns, and may
+start further operations or `remove()` sockets. The reactor is not thread safe.
+*/
+class epoll_reactor
+{
+public:
+  //! The completion handler for `async_accept()`, receiving the accepted socket
+  using accept_handler = std::function<void(result<int>)>;
+  //! The completion handler for `async_connect()`
+  using connect_handler = std::function<void(result<void>)>;
+  //! The completion handler for `async_read()` and `async_write()`, receiving the bytes transferred
+  using io_handler = std::function<void(result<size_t>)>;
+  //! The completion handler for batches, receiving the number of messages whose code has been set
+  using batch_handler = std::function<void(unsigned)>;
+
+private:
+  /* An operation, which when called with null tries to complete, returning
+  false if it would block. When called with a failure it completes with that.
+  */
+  using _op = std::function<bool(const posix_code *failure)>;
+  struct _socket
+  {
+    std::deque<_op> readers, writers;
+    bool removed{false};
+  };
+
+  int _fd{-1};
+  std::unordered_map<int, std::shared_ptr<_socket>> _sockets;
+
+  static bool _would_block(int e) noexcept { return e == EAGAIN || e == EWOULDBLOCK; }
+  // Makes an operation of a system call returning a count or -errno
+  template <class T, class Handler, class F> static _op _make_op(Handler &&handler, F syscall)
+  {
+    return [handler = std::forward<Handler>(handler), syscall](const posix_code *failure) mutable -> bool {
+      if(failure != nullptr)
+      {
+        handler(*failure);
+        return true;
+      }
+      for(;;)
+      {
+        const long ret = syscall();
+        if(ret >= 0)
+        {
+          if constexpr(std::is_void_v<T>)
+          {
+            handler(result<void>(in_place_type<void>));
+          }
+          else
+          {
+            handler(static_cast<T>(ret));
+          }
+          return true;
+        }
+        if(-ret == EINTR)
+        {
+          continue;
+        }
+        if(_would_block(static_cast<int>(-ret)))
+        {
+          return false;
+        }
+        handler(posix_code(static_cast<int>(-ret)));
+        return true;
+      }
+    };
+  }
+  void _start(int fd, bool write_side, _op op)
+  {
+    auto it = _sockets.find(fd);
+    if(it == _sockets.end())
+    {
+      const posix_code ebadf(EBADF);
+      op(&ebadf);
+      return;
+    }
+    // Keep the socket alive should the handler remove it
+    std::shared_ptr<_socket> s = it->second;
+    auto &q = write_side ? s->writers : s->readers;
+    if(q.empty() && op(nullptr))
+    {
+      return;
+    }
+    q.push_back(std::move(op));
+  }
+  static size_t _progress(_socket &s, std::deque<_op> &q)
+  {
+    size_t done = 0;
+    while(!s.removed && !q.empty())
+    {
+      _op op = std::move(q.front());
+      q.pop_front();
+      if(!op(nullptr))
+      {
+        q.push_front(std::move(op));
+        break;
+      }
+      ++done;
+    }
+    return done;
+  }
+  static void _cancel(_socket &s)
+  {
+    const posix_code cancelled(ECANCELED);
+    s.removed = true;
+    for(auto *q : {&s.readers, &s.writers})
+    {
+      while(!q->empty())
+      {
+        _op op = std::move(q->front());
+        q->pop_front();
+        op(&cancelled);
+      }
+    }
+  }
+
+public:
+  //! Constructs a closed reactor
+  epoll_reactor() = default;
+  epoll_reactor(const epoll_reactor &) = delete;
+  epoll_reactor(epoll_reactor &&) = delete;
+  epoll_reactor &operator=(const epoll_reactor &) = delete;
+  epoll_reactor &operator=(epoll_reactor &&) = delete;
+  //! Completes operations not yet completed with `errc::operation_canceled`, and closes the `epoll` descriptor.
+  ~epoll_reactor() { close(); }
+
+  //! Creates the `epoll` descriptor.
+  result<void> open() noexcept
+  {
+    if(_fd != -1)
+    {
+      return posix_code(EBUSY);
+    }
+    _fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if(_fd == -1)
+    {
+      return posix_code::current();
+    }
+    return result<void>(in_place_type<void>);
+  }
+  //! Completes operations not yet completed with `errc::operation_canceled`, and closes the `epoll` descriptor. Registered sockets are not closed.
+  void close()
+  {
+    auto sockets = std::move(_sockets);
+    _sockets.clear();
+    for(auto &i : sockets)
+    {
+      _cancel(*i.second);
+    }
+    if(_fd != -1)
+    {
+      (void) posix_io::close(_fd);
+      _fd = -1;
+    }
+  }
+  //! True if the `epoll` descriptor has been created
+  bool is_open() const noexcept { return _fd != -1; }
+  //! The `epoll` descriptor
+  int native_handle() const noexcept { return _fd; }
+
+  //! Registers socket `fd`, making it non-blocking.
+  result<void> add(int fd)
+  {
+    const int flags = ::fcntl(fd, F_GETFL);
+    if(flags == -1 || ((flags & O_NONBLOCK) == 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1))
+    {
+      return posix_code::current();
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    ev.data.fd = fd;
+    if(::epoll_ctl(_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+    {
+      return posix_code::current();
+    }
+    _sockets[fd] = std::make_shared<_socket>();
+    return result<void>(in_place_type<void>);
+  }
+  //! Deregisters socket `fd`, completing its operations not yet completed with `errc::operation_canceled`. The socket is not closed.
+  result<void> remove(int fd)
+  {
+    auto it = _sockets.find(fd);
+    if(it == _sockets.end())
+    {
+      return posix_code(ENOENT);
+    }
+    std::shared_ptr<_socket> s = std::move(it->second);
+    _sockets.erase(it);
+    const int ret = ::epoll_ctl(_fd, EPOLL_CTL_DEL, fd, nullptr);
+    const int e = errno;
+    _cancel(*s);
+    if(ret == -1)
+    {
+      return posix_code(e);
+    }
+    return result<void>(in_place_type<void>);
+  }
+  //! The number of operations waiting for their socket to become ready
+  size_t outstanding() const noexcept
+  {
+    size_t ret = 0;
+    for(auto &i : _sockets)
+    {
+      ret += i.second->readers.size() + i.second->writers.size();
+    }
+    return ret;
+  }
+
+  /*! Waits up to `timeout_ms` milliseconds, or forever if -1, for registered
+  sockets to become ready, and progresses their operations. Returns the number
+  of operations completed, which is zero if interrupted by a signal.
+  */
+  result<size_t> run_once(int timeout_ms = -1)
+  {
+    epoll_event events[64];
+    const int n = ::epoll_wait(_fd, events, 64, timeout_ms);
+    if(n == -1)
+    {
+      const int e = errno;
+      if(e == EINTR)
+      {
+        return size_t(0);
+      }
+      return posix_code(e);
+    }
+    size_t done = 0;
+    for(int i = 0; i < n; i++)
+    {
+      auto it = _sockets.find(events[i].data.fd);
+      if(it == _sockets.end())
+      {
+        continue;  // removed by a handler of an earlier event
+      }
+      std::shared_ptr<_socket> s = it->second;
+      const uint32_t ev = events[i].events;
+      if((ev & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0)
+      {
+        done += _progress(*s, s->readers);
+      }
+      if((ev & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0)
+      {
+        done += _progress(*s, s->writers);
+      }
+    }
+    return done;
+  }
+
+  //! Accepts a connection on listening socket `fd`. The accepted socket is non-blocking and close on exec, and is not registered.
+  void async_accept(int fd, accept_handler handler)
+  {
+    _start(fd, false, _make_op<int>(std::move(handler), [fd]() -> long {
+             const int ret = ::accept4(fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+             return (ret >= 0) ? ret : -errno;
+           }));
+  }
+  //! Connects socket `fd` to `addr`, which is copied.
+  void async_connect(int fd, const sockaddr *addr, socklen_t addrlen, connect_handler handler)
+  {
+    sockaddr_storage to{};
+    if(addrlen > sizeof(to))
+    {
+      handler(posix_code(EINVAL));
+      return;
+    }
+    memcpy(&to, addr, addrlen);
+    // A connect in progress is polled by connecting again, which reports the outcome once there is one
+    _start(fd, true, _make_op<void>(std::move(handler), [fd, to, addrlen]() -> long {
+             if(::connect(fd, reinterpret_cast<const sockaddr *>(&to), addrlen) == 0)
+             {
+               return 0;
+             }
+             const int e = errno;
+             if(e == EISCONN)
+             {
+               return 0;
+             }
+             return (e == EINPROGRESS || e == EALREADY) ? -EAGAIN : -e;
+           }));
+  }
+  //! Reads up to `bytes` into `buffer`, which must remain valid until completion. Zero bytes read means end of stream.
+  void async_read(int fd, void *buffer, size_t bytes, io_handler handler)
+  {
+    _start(fd, false, _make_op<size_t>(std::move(handler), [fd, buffer, bytes]() -> long {
+             const ssize_t ret = ::read(fd, buffer, bytes);
+             return (ret >= 0) ? static_cast<long>(ret) : -errno;
+           }));
+  }
+  //! Writes up to `bytes` from `buffer`, which must remain valid until completion.
+  void async_write(int fd, const void *buffer, size_t bytes, io_handler handler)
+  {
+    _start(fd, true, _make_op<size_t>(std::move(handler), [fd, buffer, bytes]() -> long {
+             const ssize_t ret = ::send(fd, buffer, bytes, MSG_NOSIGNAL);
+             return (ret >= 0) ? static_cast<long>(ret) : -errno;
+           }));
+  }
+
+  /*! Receives up to `count` messages into `msgs`. Completes once at least
+  one message has been received, setting `codes[n]` to success for each
+  message received, whose length is in `msgs[n].msg_len`. If receiving fails,
+  the code of the message after those received is set to the failure. The
+  handler receives the number of codes set. `msgs` and `codes` must remain
+  valid until completion.
+  */
+  void async_recvmmsg(int fd, mmsghdr *msgs, posix_code *codes, unsigned count, batch_handler handler)
+  {
+    _start(fd, false, [=, handler = std::move(handler)](const posix_code *failure) mutable -> bool {
+      if(failure != nullptr)
+      {
+        codes[0] = *failure;
+        handler(1);
+        return true;
+      }
+      for(;;)
+      {
+        const int ret = ::recvmmsg(fd, msgs, count, 0, nullptr);
+        if(ret >= 0)
+        {
+          for(int n = 0; n < ret; n++)
+          {
+            codes[n] = posix_code(0);
+          }
+          handler(static_cast<unsigned>(ret));
+          return true;
+        }
+        const int e = errno;
+        if(e == EINTR)
+        {
+          continue;
+        }
+        if(_would_block(e))
+        {
+          return false;
+        }
+        codes[0] = posix_code(e);
+        handler(1);
+        return true;
+      }
+    });
+  }
+  /*! Sends the `count` messages `msgs`. Completes once every message has
+  been sent or has failed, setting `codes[n]` to the outcome of `msgs[n]`,
+  whose length sent is in `msgs[n].msg_len`. A message failing does not stop
+  those after it being sent. The handler receives `count`. `msgs` and `codes`
+  must remain valid until completion.
+  */
+  void async_sendmmsg(int fd, mmsghdr *msgs, posix_code *codes, unsigned count, batch_handler handler)
+  {
+    _start(fd, true, [=, handler = std::move(handler), sent = 0U](const posix_code *failure) mutable -> bool {
+      if(failure != nullptr)
+      {
+        for(; sent < count; sent++)
+        {
+          codes[sent] = *failure;
+        }
+        handler(count);
+        return true;
+      }
+      while(sent < count)
+      {
+        const int ret = ::sendmmsg(fd, msgs + sent, count - sent, MSG_NOSIGNAL);
+        if(ret >= 0)
+        {
+          for(int n = 0; n < ret; n++)
+          {
+            codes[sent++] = posix_code(0);
+          }
+          continue;
+        }
+        const int e = errno;
+        if(e == EINTR)
+        {
+          continue;
+        }
+        if(_would_block(e))
+        {
+          return false;
+        }
+        // The failure is that of the first message not sent
+        codes[sent++] = posix_code(e);
+      }
+      handler(count);
+      return true;
+    });
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
+
+#endif
@@ -277,6 +277,20 @@ namespace traits
   };
 }  // namespace traits
 
+namespace detail
+{
+  template <class ErasedType> struct bulk_destroy<errored_status_code<erased<ErasedType>>>
+  {
+    static void destroy(errored_status_code<erased<ErasedType>> &v) noexcept
+    {
+      if(!v.empty() && (v.domain().flags() & status_code_domain::flag_trivially_erasable) == 0)
+      {
+        v.~errored_status_code();
+      }
+    }
+  };
+}  // namespace detail
+
 
 //! True if the status code's are semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2> inline bool operator==(const errored_status_code<DomainType1> &a, const errored_status_code<DomainType2> &b) noexcept
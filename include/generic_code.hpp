@@ -304,7 +304,7 @@ public:
 public:
   //! Default constructor
   constexpr explicit _generic_code_domain(typename _base::unique_id_type id = 0x746d6354f4f733e9) noexcept
-      : _base(id)
+      : _base(id, _base::flag_trivially_erasable)
   {
   }
   _generic_code_domain(const _generic_code_domain &) = default;
@@ -339,6 +339,13 @@ protected:
     assert(code.domain() == *this);                  // NOLINT
     return static_cast<const generic_code &>(code);  // NOLINT
   }
+  virtual void _do_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept override  // NOLINT
+  {
+    for(size_t n = 0; n < count; n++)
+    {
+      out[n] = detail::erasure_cast<errc>(values[n]);
+    }
+  }
   virtual _base::string_ref _do_message(const status_code<void> &code) const noexcept override  // NOLINT
   {
     assert(code.domain() == *this);                           // NOLINT
@@ -358,6 +365,7 @@ protected:
 using generic_error = status_error<_generic_code_domain>;
 //! A constexpr source variable for the generic code domain, which is that of `errc` (POSIX). Returned by `_generic_code_domain::get()`.
 constexpr _generic_code_domain generic_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(generic_code_domain);
 inline constexpr const _generic_code_domain &_generic_code_domain::get()
 {
   return generic_code_domain;
@@ -398,6 +406,33 @@ template <class T> inline bool status_code<void>::equivalent(const status_code<T
   // If we are both empty, we are equivalent, otherwise not equivalent
   return (!_domain && !o._domain);
 }
+inline generic_code status_code<void>::to_generic_code() const noexcept
+{
+  return (_domain != nullptr) ? _domain->_generic_code(*this) : generic_code();
+}
+namespace detail
+{
+  // A code of a trivially erasable domain made from its value as erased into `intptr_t`, which needs no destruction
+  class erased_value_code : public status_code_storage<erased<intptr_t>>
+  {
+    using _base = status_code_storage<erased<intptr_t>>;
+
+  public:
+    constexpr erased_value_code(const status_code_domain *domain, intptr_t value) noexcept
+        : _base(_base::_value_type_constructor{}, domain, value)
+    {
+    }
+  };
+}  // namespace detail
+inline void status_code_domain::_do_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept
+{
+  const bool trivially_erasable = (_flags & flag_trivially_erasable) != 0;
+  for(size_t n = 0; n < count; n++)
+  {
+    // Otherwise the values alone may not be the codes
+    out[n] = trivially_erasable ? _generic_code(detail::erased_value_code(this, values[n])).value() : errc::unknown;
+  }
+}
 //! True if the status code's are semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2> inline bool operator==(const status_code<DomainType1> &a, const status_code<DomainType2> &b) noexcept
 {
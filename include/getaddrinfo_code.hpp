@@ -26,6 +26,9 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define SYSTEM_ERROR2_GETADDRINFO_CODE_HPP
 
 #include "quick_status_code_from_enum.hpp"
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+#include "posix_code.hpp"
+#endif
 
 #ifdef _WIN32
 #error Not available for Microsoft Windows
@@ -35,15 +38,55 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include <sys/types.h>
 #endif
 
+#include <atomic>
+#include <cerrno>
+#include <cstring>  // for strerror_r
+#include <thread>   // for this_thread::yield
+
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
 class _getaddrinfo_code_domain;
-//! A getaddrinfo error code, those returned by `getaddrinfo()`.
+//! A getaddrinfo error code, those returned by `getaddrinfo()`, plus the `errno` for `EAI_SYSTEM`.
 using getaddrinfo_code = status_code<_getaddrinfo_code_domain>;
 //! A specialisation of `status_error` for the `getaddrinfo()` error code domain.
 using getaddrinfo_error = status_error<_getaddrinfo_code_domain>;
 
+namespace detail
+{
+  /* A getaddrinfo_code packs the EAI value into the low half of an intptr_t,
+  and the errno for EAI_SYSTEM into the high half, so it still fits into a
+  system_code. EAI values are small, and may be negative.
+  */
+  constexpr int getaddrinfo_code_shift = (sizeof(intptr_t) >= 8) ? 32 : 16;
+  constexpr intptr_t getaddrinfo_code_pack(int eai, int errcode) noexcept { return static_cast<intptr_t>(eai) + static_cast<intptr_t>(static_cast<uintptr_t>(errcode) << getaddrinfo_code_shift); }
+  constexpr int getaddrinfo_code_eai(intptr_t v) noexcept { return (getaddrinfo_code_shift == 32) ? static_cast<int>(static_cast<int32_t>(static_cast<uint32_t>(v))) : static_cast<int>(static_cast<int16_t>(static_cast<uint16_t>(v))); }
+  constexpr int getaddrinfo_code_errno(intptr_t v) noexcept { return static_cast<int>((v - getaddrinfo_code_eai(v)) >> getaddrinfo_code_shift); }
+}  // namespace detail
+
+namespace mixins
+{
+  template <class Base> struct mixin<Base, _getaddrinfo_code_domain> : public Base
+  {
+    using Base::Base;
+
+    /*! Returns a `getaddrinfo_code` for a value returned by `getaddrinfo()`,
+    capturing `errno` if that value is `EAI_SYSTEM`. Call this immediately after
+    `getaddrinfo()`, before anything else can change `errno`.
+    */
+    static getaddrinfo_code from_return(int eai, int errcode = errno) noexcept;
+
+    //! Returns the `EAI_*` value returned by `getaddrinfo()`.
+    constexpr int eai() const noexcept { return detail::getaddrinfo_code_eai(this->value()); }
+    //! Returns the `errno` captured for `EAI_SYSTEM`, or zero if there is none.
+    constexpr int system_errno() const noexcept { return detail::getaddrinfo_code_errno(this->value()); }
+  };
+}  // namespace mixins
+
 /*! The implementation of the domain for `getaddrinfo()` error codes, those returned by `getaddrinfo()`.
+
+When `getaddrinfo()` fails with `EAI_SYSTEM`, the real cause is in `errno`. If
+captured, it is packed into the same value, and is used for mapping to generic
+codes, for equivalence and for the message.
  */
 class _getaddrinfo_code_domain : public status_code_domain
 {
@@ -51,14 +94,126 @@ class _getaddrinfo_code_domain : public status_code_domain
   template <class StatusCode> friend class detail::indirecting_domain;
   using _base = status_code_domain;
 
+  static _base::string_ref _make_string_ref(int eai, int errcode) noexcept
+  {
+    if(errcode == 0)
+    {
+      return _base::string_ref(gai_strerror(eai));
+    }
+    /* Messages combining EAI_SYSTEM's text with that of its errno are formatted
+    once per errno into static storage, so returning them never allocates.
+    The slots are keyed by errno, so any errno value can have one, and there
+    are more of them than there are errno values on any platform. Only if they
+    are all in use, fall back to the text for the EAI value alone.
+    */
+    struct slot
+    {
+      std::atomic<int> errcode;  // zero if empty, claimed by compare and swap
+      std::atomic<bool> ready;   // set after msg is written
+      char msg[120];
+    };
+    static constexpr size_t slot_count = 256;
+    static slot slots[slot_count];
+    if(errcode < 0)
+    {
+      return _base::string_ref(gai_strerror(eai));
+    }
+    for(size_t n = 0; n < slot_count; n++)
+    {
+      slot &s = slots[(static_cast<size_t>(errcode) + n) % slot_count];
+      int key = s.errcode.load(std::memory_order_acquire);
+      if(key == 0 && s.errcode.compare_exchange_strong(key, errcode, std::memory_order_acquire, std::memory_order_acquire))
+      {
+        char buffer[sizeof(s.msg)] = "";
+#if defined(__gnu_linux__) && !defined(__ANDROID__)  // handle glibc's weird strerror_r()
+        const char *errstr = strerror_r(errcode, buffer, sizeof(buffer));  // NOLINT
+        if(errstr == nullptr)
+        {
+          errstr = buffer;
+        }
+#else
+        strerror_r(errcode, buffer, sizeof(buffer));
+        const char *errstr = buffer;
+#endif
+        const char *gaistr = gai_strerror(eai);
+        size_t len = 0;
+        for(const char *i = gaistr; *i != 0 && len < sizeof(s.msg) - 3; ++i)
+        {
+          s.msg[len++] = *i;
+        }
+        s.msg[len++] = ':';
+        s.msg[len++] = ' ';
+        for(const char *i = errstr; *i != 0 && len < sizeof(s.msg) - 1; ++i)
+        {
+          s.msg[len++] = *i;
+        }
+        s.msg[len] = 0;
+        s.ready.store(true, std::memory_order_release);
+        return _base::string_ref(s.msg);
+      }
+      if(key == errcode)
+      {
+        // Another thread may be formatting it, which takes a few microseconds
+        while(!s.ready.load(std::memory_order_acquire))
+        {
+          std::this_thread::yield();
+        }
+        return _base::string_ref(s.msg);
+      }
+    }
+    return _base::string_ref(gai_strerror(eai));
+  }
+  static errc _eai_to_errc(int eai) noexcept
+  {
+    switch(eai)
+    {
+    case 0:
+      return errc::success;
+#ifdef EAI_ADDRFAMILY
+    case EAI_ADDRFAMILY:
+      return errc::no_such_device_or_address;
+#endif
+    case EAI_FAIL:
+      return errc::io_error;
+    case EAI_MEMORY:
+      return errc::not_enough_memory;
+#ifdef EAI_NODATA
+    case EAI_NODATA:
+      return errc::no_such_device_or_address;
+#endif
+    case EAI_NONAME:
+      return errc::no_such_device_or_address;
+#ifdef EAI_OVERFLOW
+    case EAI_OVERFLOW:
+      return errc::argument_list_too_long;
+#endif
+    case EAI_BADFLAGS:  // fallthrough
+    case EAI_SERVICE:
+      return errc::invalid_argument;
+    case EAI_FAMILY:  // fallthrough
+    case EAI_SOCKTYPE:
+      return errc::operation_not_supported;
+    case EAI_AGAIN:  // fallthrough
+    case EAI_SYSTEM:
+      return errc::resource_unavailable_try_again;
+    default:
+      return errc::unknown;
+    }
+  }
+  static errc _to_errc(intptr_t v) noexcept
+  {
+    const int errcode = detail::getaddrinfo_code_errno(v);
+    return (errcode != 0) ? static_cast<errc>(errcode) : _eai_to_errc(detail::getaddrinfo_code_eai(v));
+  }
+
 public:
-  //! The value type of the `getaddrinfo()` code, which is an `int`
-  using value_type = int;
+  //! The value type of the `getaddrinfo()` code, which is an `intptr_t` packing the `EAI_*` value and any `errno`
+  using value_type = intptr_t;
   using _base::string_ref;
 
   //! Default constructor
   constexpr explicit _getaddrinfo_code_domain(typename _base::unique_id_type id = 0x5b24b2de470ff7b6) noexcept
-      : _base(id)
+      : _base(id, _base::flag_trivially_erasable)
   {
   }
   _getaddrinfo_code_domain(const _getaddrinfo_code_domain &) = default;
@@ -86,50 +241,32 @@ protected:
       const auto &c2 = static_cast<const getaddrinfo_code &>(code2);  // NOLINT
       return c1.value() == c2.value();
     }
+    if(code2.domain() == generic_code_domain)
+    {
+      const auto &c2 = static_cast<const generic_code &>(code2);  // NOLINT
+      return c2.value() == _to_errc(c1.value());
+    }
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    if(code2.domain() == posix_code_domain)
+    {
+      const auto &c2 = static_cast<const posix_code &>(code2);  // NOLINT
+      const int errcode = detail::getaddrinfo_code_errno(c1.value());
+      return errcode != 0 && c2.value() == errcode;
+    }
+#endif
     return false;
   }
   virtual generic_code _generic_code(const status_code<void> &code) const noexcept override  // NOLINT
   {
     assert(code.domain() == *this);                               // NOLINT
     const auto &c = static_cast<const getaddrinfo_code &>(code);  // NOLINT
-    switch(c.value())
-    {
-#ifdef EAI_ADDRFAMILY
-    case EAI_ADDRFAMILY:
-      return errc::no_such_device_or_address;
-#endif
-    case EAI_FAIL:
-      return errc::io_error;
-    case EAI_MEMORY:
-      return errc::not_enough_memory;
-#ifdef EAI_NODATA
-    case EAI_NODATA:
-      return errc::no_such_device_or_address;
-#endif
-    case EAI_NONAME:
-      return errc::no_such_device_or_address;
-#ifdef EAI_OVERFLOW
-    case EAI_OVERFLOW:
-      return errc::argument_list_too_long;
-#endif
-    case EAI_BADFLAGS:  // fallthrough
-    case EAI_SERVICE:
-      return errc::invalid_argument;
-    case EAI_FAMILY:  // fallthrough
-    case EAI_SOCKTYPE:
-      return errc::operation_not_supported;
-    case EAI_AGAIN:  // fallthrough
-    case EAI_SYSTEM:
-      return errc::resource_unavailable_try_again;
-    default:
-      return errc::unknown;
-    }
+    return generic_code(_to_errc(c.value()));
   }
   virtual string_ref _do_message(const status_code<void> &code) const noexcept override  // NOLINT
   {
     assert(code.domain() == *this);                               // NOLINT
     const auto &c = static_cast<const getaddrinfo_code &>(code);  // NOLINT
-    return string_ref(gai_strerror(c.value()));
+    return _make_string_ref(detail::getaddrinfo_code_eai(c.value()), detail::getaddrinfo_code_errno(c.value()));
   }
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
@@ -142,11 +279,17 @@ protected:
 };
 //! A constexpr source variable for the `getaddrinfo()` code domain, which is that of `getaddrinfo()`. Returned by `_getaddrinfo_code_domain::get()`.
 constexpr _getaddrinfo_code_domain getaddrinfo_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(getaddrinfo_code_domain);
 inline constexpr const _getaddrinfo_code_domain &_getaddrinfo_code_domain::get()
 {
   return getaddrinfo_code_domain;
 }
 
+namespace mixins
+{
+  template <class Base> inline getaddrinfo_code mixin<Base, _getaddrinfo_code_domain>::from_return(int eai, int errcode) noexcept { return getaddrinfo_code(detail::getaddrinfo_code_pack(eai, (eai == EAI_SYSTEM) ? errcode : 0)); }
+}  // namespace mixins
+
 SYSTEM_ERROR2_NAMESPACE_END
 
 #endif
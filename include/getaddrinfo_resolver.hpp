@@ -0,0 +1,350 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_GETADDRINFO_RESOLVER_HPP
+#define SYSTEM_ERROR2_GETADDRINFO_RESOLVER_HPP
+
+#include "getaddrinfo_code.hpp"
+#include "result.hpp"
+
+#if(__cplusplus >= 201703L || _HAS_CXX17) && __has_include(<variant>)
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>  // for memcpy
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \class getaddrinfo_resolver
+\brief Runs `getaddrinfo()` on a bounded pool of worker threads, only available on C++ 17 or later.
+
+Lookups complete by calling a completion handler with a
+`result<std::shared_ptr<const addresses>>`, whose error is the
+`getaddrinfo_code` returned by `getaddrinfo()`, including the `errno` for
+`EAI_SYSTEM`. The handler is called on the worker thread which performed the
+lookup, or on the calling thread if the answer was already in the cache. It
+should therefore be quick, typically just posting the result to whichever
+event loop wants it.
+
+Concurrent lookups of the same query share a single call to `getaddrinfo()`.
+Successful answers are cached for `config::positive_ttl`, and answers which
+say the name does not exist (`EAI_NONAME` and `EAI_NODATA`) are cached for
+`config::negative_ttl`. Transient failures such as `EAI_AGAIN` are never
+cached. `getaddrinfo()` does not report DNS TTLs, so these are fixed.
+
+Destroying the resolver completes lookups not yet started with
+`errc::operation_canceled`, on the destroying thread, then waits for lookups
+in progress to complete.
+*/
+class getaddrinfo_resolver
+{
+public:
+  //! One resolved address
+  struct address
+  {
+    int family{0}, socktype{0}, protocol{0};
+    socklen_t addrlen{0};
+    sockaddr_storage addr{};
+  };
+  //! The addresses resolved for a query, in the order returned by `getaddrinfo()`
+  using addresses = std::vector<address>;
+  //! The outcome of a lookup
+  using result_type = result<std::shared_ptr<const addresses>>;
+  //! The completion handler for a lookup
+  using completion_handler = std::function<void(result_type)>;
+
+  //! Configuration of the resolver
+  struct config
+  {
+    //! The number of worker threads, and thus the maximum number of concurrent calls to `getaddrinfo()`
+    size_t threads{4};
+    //! How long a successful answer is cached
+    std::chrono::steady_clock::duration positive_ttl{std::chrono::seconds(60)};
+    //! How long an answer that the name does not exist is cached
+    std::chrono::steady_clock::duration negative_ttl{std::chrono::seconds(5)};
+    //! The maximum number of cached answers
+    size_t max_cache_entries{4096};
+  };
+
+  //! Statistics about the resolver
+  struct statistics
+  {
+    //! Calls made to `getaddrinfo()`
+    size_t lookups{0};
+    //! Lookups answered from the cache
+    size_t cache_hits{0};
+    //! Lookups which joined an identical lookup already in progress
+    size_t coalesced{0};
+  };
+
+private:
+  using _clock = std::chrono::steady_clock;
+  struct _query
+  {
+    std::string host, service;
+    int family, socktype, flags;
+    bool operator<(const _query &o) const noexcept { return std::tie(host, service, family, socktype, flags) < std::tie(o.host, o.service, o.family, o.socktype, o.flags); }
+  };
+  struct _answer
+  {
+    _clock::time_point expiry;
+    std::shared_ptr<const addresses> addrs;
+    getaddrinfo_code code{0};
+  };
+
+  const config _config;
+  mutable std::mutex _lock;
+  std::condition_variable _changed;
+  bool _stopping{false};
+  std::map<_query, _answer> _cache;
+  std::map<_query, std::vector<completion_handler>> _inflight;
+  std::deque<_query> _pending;
+  statistics _stats;
+  std::vector<std::thread> _workers;
+
+  static result_type _to_result(const _answer &a)
+  {
+    if(a.code.failure())
+    {
+      return a.code;
+    }
+    return result_type(a.addrs);
+  }
+  static bool _is_cacheable(int eai) noexcept
+  {
+    switch(eai)
+    {
+    case 0:
+    case EAI_NONAME:
+#ifdef EAI_NODATA
+#if EAI_NODATA != EAI_NONAME
+    case EAI_NODATA:
+#endif
+#endif
+      return true;
+    default:
+      return false;
+    }
+  }
+  // Must be called with _lock held
+  void _insert_into_cache(const _query &q, _answer a)
+  {
+    if(_cache.size() >= _config.max_cache_entries)
+    {
+      const auto now = _clock::now();
+      for(auto it = _cache.begin(); it != _cache.end();)
+      {
+        it = (it->second.expiry <= now) ? _cache.erase(it) : std::next(it);
+      }
+      while(!_cache.empty() && _cache.size() >= _config.max_cache_entries)
+      {
+        auto oldest = _cache.begin();
+        for(auto it = _cache.begin(); it != _cache.end(); ++it)
+        {
+          if(it->second.expiry < oldest->second.expiry)
+          {
+            oldest = it;
+          }
+        }
+        _cache.erase(oldest);
+      }
+    }
+    if(_config.max_cache_entries > 0)
+    {
+      _cache[q] = std::move(a);
+    }
+  }
+  static _answer _lookup(const _query &q)
+  {
+    addrinfo hints{};
+    hints.ai_family = q.family;
+    hints.ai_socktype = q.socktype;
+    hints.ai_flags = q.flags;
+    addrinfo *res = nullptr;
+    _answer ret;
+    const int eai = ::getaddrinfo(q.host.empty() ? nullptr : q.host.c_str(), q.service.empty() ? nullptr : q.service.c_str(), &hints, &res);
+    ret.code = getaddrinfo_code::from_return(eai);
+    if(eai == 0)
+    {
+      auto addrs = std::make_shared<addresses>();
+      for(addrinfo *i = res; i != nullptr; i = i->ai_next)
+      {
+        address a;
+        a.family = i->ai_family;
+        a.socktype = i->ai_socktype;
+        a.protocol = i->ai_protocol;
+        a.addrlen = (i->ai_addrlen <= sizeof(a.addr)) ? static_cast<socklen_t>(i->ai_addrlen) : static_cast<socklen_t>(sizeof(a.addr));
+        memcpy(&a.addr, i->ai_addr, a.addrlen);
+        addrs->push_back(a);
+      }
+      freeaddrinfo(res);
+      ret.addrs = std::move(addrs);
+    }
+    return ret;
+  }
+  void _worker()
+  {
+    std::unique_lock<std::mutex> g(_lock);
+    for(;;)
+    {
+      _changed.wait(g, [this] { return _stopping || !_pending.empty(); });
+      if(_stopping)
+      {
+        return;
+      }
+      _query q = std::move(_pending.front());
+      _pending.pop_front();
+      ++_stats.lookups;
+      g.unlock();
+      _answer a = _lookup(q);
+      g.lock();
+      a.expiry = _clock::now() + (a.code.success() ? _config.positive_ttl : _config.negative_ttl);
+      if(_is_cacheable(a.code.eai()))
+      {
+        _insert_into_cache(q, a);
+      }
+      auto it = _inflight.find(q);
+      std::vector<completion_handler> handlers(std::move(it->second));
+      _inflight.erase(it);
+      g.unlock();
+      for(auto &h : handlers)
+      {
+        h(_to_result(a));
+      }
+      g.lock();
+    }
+  }
+
+public:
+  //! Constructs the resolver with the default configuration.
+  getaddrinfo_resolver()
+      : getaddrinfo_resolver(config())
+  {
+  }
+  //! Constructs the resolver, launching `cfg.threads` worker threads (at least one).
+  explicit getaddrinfo_resolver(config cfg)
+      : _config(cfg)
+  {
+    const size_t threads = (_config.threads > 0) ? _config.threads : 1;
+    _workers.reserve(threads);
+    for(size_t n = 0; n < threads; n++)
+    {
+      _workers.emplace_back([this] { _worker(); });
+    }
+  }
+  getaddrinfo_resolver(const getaddrinfo_resolver &) = delete;
+  getaddrinfo_resolver(getaddrinfo_resolver &&) = delete;
+  getaddrinfo_resolver &operator=(const getaddrinfo_resolver &) = delete;
+  getaddrinfo_resolver &operator=(getaddrinfo_resolver &&) = delete;
+  //! Cancels lookups not yet started, then waits for lookups in progress.
+  ~getaddrinfo_resolver()
+  {
+    std::vector<completion_handler> cancelled;
+    {
+      // Which lookups have started is decided here, once, as no worker starts another after this
+      std::lock_guard<std::mutex> g(_lock);
+      _stopping = true;
+      for(auto &q : _pending)
+      {
+        auto it = _inflight.find(q);
+        for(auto &h : it->second)
+        {
+          cancelled.push_back(std::move(h));
+        }
+        _inflight.erase(it);
+      }
+      _pending.clear();
+    }
+    _changed.notify_all();
+    for(auto &h : cancelled)
+    {
+      h(result_type(generic_code(errc::operation_canceled)));
+    }
+    for(auto &t : _workers)
+    {
+      t.join();
+    }
+  }
+
+  /*! Resolves `host` and `service` as `getaddrinfo()` would with hints of `family`,
+  `socktype` and `flags`, calling `handler` with the outcome. An empty `host` or
+  `service` is passed to `getaddrinfo()` as null.
+  */
+  void resolve(std::string host, std::string service, completion_handler handler, int family = AF_UNSPEC, int socktype = 0, int flags = 0)
+  {
+    _query q{std::move(host), std::move(service), family, socktype, flags};
+    std::unique_lock<std::mutex> g(_lock);
+    auto cached = _cache.find(q);
+    if(cached != _cache.end())
+    {
+      if(cached->second.expiry > _clock::now())
+      {
+        ++_stats.cache_hits;
+        _answer a = cached->second;
+        g.unlock();
+        handler(_to_result(a));
+        return;
+      }
+      _cache.erase(cached);
+    }
+    auto inflight = _inflight.find(q);
+    if(inflight != _inflight.end())
+    {
+      ++_stats.coalesced;
+      inflight->second.push_back(std::move(handler));
+      return;
+    }
+    _inflight[q].push_back(std::move(handler));
+    _pending.push_back(std::move(q));
+    g.unlock();
+    _changed.notify_one();
+  }
+
+  //! Returns a snapshot of the statistics
+  statistics stats() const
+  {
+    std::lock_guard<std::mutex> g(_lock);
+    return _stats;
+  }
+  //! Discards all cached answers
+  void clear_cache()
+  {
+    std::lock_guard<std::mutex> g(_lock);
+    _cache.clear();
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,478 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_IO_URING_ENGINE_HPP
+#define SYSTEM_ERROR2_IO_URING_ENGINE_HPP
+
+#include "posix_io.hpp"
+
+#if(__cplusplus >= 201703L || _HAS_CXX17) && __has_include(<variant>)
+
+#ifndef __linux__
+#error Only available on Linux
+#else
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#endif
+
+#include <cstdint>  // for uint32_t
+#include <cstring>  // for memset
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // Makes an io_uring system call, returning the negated error number on failure, without reading errno where possible
+  inline long io_uring_syscall(long nr, long a, long b, long c = 0, long d = 0, long e = 0, long f = 0) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return posix_io_syscall(nr, a, b, c, d, e, f);
+#else
+    const long ret = ::syscall(nr, a, b, c, d, e, f);
+    return (ret == -1) ? -errno : ret;
+#endif
+  }
+}  // namespace detail
+
+/*! An asynchronous i/o engine on Linux's `io_uring`, made directly with system
+calls so there is no dependency on liburing, only available on C++ 17 or later.
+
+Operations are prepared by the `prep_*()` functions, which fill in the next
+free submission queue entry and return it so that further fields may be set,
+or return null if the submission queue is full. Nothing is passed to the
+kernel until `submit()`, so any number of operations are submitted with a
+single system call. `sqe_flags` takes the `IOSQE_*` flags, such as
+`IOSQE_IO_LINK` to start the next operation only if this one succeeds, and
+`IOSQE_FIXED_FILE` to use an index into the files registered with
+`register_files()` instead of a file descriptor. Buffers registered with
+`register_buffers()` are used by `prep_read_fixed()` and `prep_write_fixed()`.
+
+Completions are read directly from the mapped completion queue. Their `res`
+is the kernel's result, on failure the negated error number, which
+`completion::code()` and `completion::to_result()` turn into a `posix_code`
+without reading `errno`, allocating, or calling into the domain. Reaping
+completions makes no system calls, unless waiting for them with `wait()`.
+
+An engine is not thread safe. Use one per thread.
+*/
+class io_uring_engine
+{
+public:
+  //! A completed operation
+  struct completion
+  {
+    //! The `user_data` the operation was prepared with
+    uint64_t user_data;
+    //! The result of the operation, the negated error number on failure
+    int32_t res;
+    //! The `IORING_CQE_F_*` flags
+    uint32_t flags;
+
+    //! True if the operation failed
+    bool has_error() const noexcept { return res < 0; }
+    //! Returns the failure as a posix code, or a success code
+    posix_code code() const noexcept { return posix_code((res < 0) ? -res : 0); }
+    //! Returns the result of the operation as a byte count or file descriptor, or the failure as a posix code
+    result<size_t> to_result() const noexcept
+    {
+      if(res < 0)
+      {
+        return posix_code(-res);
+      }
+      return static_cast<size_t>(res);
+    }
+  };
+
+private:
+  int _fd{-1};
+  void *_sq_ring{nullptr}, *_cq_ring{nullptr};
+  size_t _sq_ring_bytes{0}, _cq_ring_bytes{0};
+  io_uring_sqe *_sqes{nullptr};
+  size_t _sqes_bytes{0};
+
+  // The parts of the submission and completion queues shared with the kernel
+  unsigned *_sq_khead{nullptr}, *_sq_ktail{nullptr};
+  unsigned _sq_mask{0}, _sq_entries{0};
+  unsigned *_cq_khead{nullptr}, *_cq_ktail{nullptr};
+  unsigned _cq_mask{0}, _cq_entries{0};
+  io_uring_cqe *_cqes{nullptr};
+  // Entries prepared, and those of them passed to the kernel
+  unsigned _sq_tail{0}, _sq_submitted{0};
+
+  template <class T> static T *_at(void *base, uint32_t offset) noexcept { return reinterpret_cast<T *>(static_cast<char *>(base) + offset); }
+  static result<void> _map(void *&out, size_t bytes, int fd, off_t offset) noexcept
+  {
+    out = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    if(out == MAP_FAILED)
+    {
+      out = nullptr;
+      return posix_code::current();
+    }
+    return result<void>(in_place_type<void>);
+  }
+  io_uring_sqe *_prep(uint8_t opcode, int fd, const void *addr, uint32_t len, uint64_t offset, uint64_t user_data, uint8_t sqe_flags) noexcept
+  {
+    io_uring_sqe *sqe = get_sqe();
+    if(sqe != nullptr)
+    {
+      sqe->opcode = opcode;
+      sqe->flags = sqe_flags;
+      sqe->fd = fd;
+      sqe->off = offset;
+      sqe->addr = reinterpret_cast<uintptr_t>(addr);
+      sqe->len = len;
+      sqe->user_data = user_data;
+    }
+    return sqe;
+  }
+  // The IORING_SETUP_* flags which need nothing more from open(), and leave the rings laid out as this engine expects
+  static constexpr unsigned _supported_setup_flags() noexcept
+  {
+    return IORING_SETUP_IOPOLL | IORING_SETUP_CLAMP
+#ifdef IORING_SETUP_SUBMIT_ALL
+           | IORING_SETUP_SUBMIT_ALL
+#endif
+#ifdef IORING_SETUP_COOP_TASKRUN
+           | IORING_SETUP_COOP_TASKRUN
+#endif
+#ifdef IORING_SETUP_TASKRUN_FLAG
+           | IORING_SETUP_TASKRUN_FLAG
+#endif
+#ifdef IORING_SETUP_SINGLE_ISSUER
+           | IORING_SETUP_SINGLE_ISSUER
+#endif
+#ifdef IORING_SETUP_DEFER_TASKRUN
+           | IORING_SETUP_DEFER_TASKRUN
+#endif
+      ;
+  }
+  result<void> _register(unsigned opcode, const void *arg, unsigned count) noexcept
+  {
+    return detail::posix_io_result<void>(detail::io_uring_syscall(SYS_io_uring_register, _fd, opcode, reinterpret_cast<long>(arg), count));
+  }
+
+public:
+  //! Constructs a closed engine
+  io_uring_engine() = default;
+  io_uring_engine(const io_uring_engine &) = delete;
+  io_uring_engine(io_uring_engine &&) = delete;
+  io_uring_engine &operator=(const io_uring_engine &) = delete;
+  io_uring_engine &operator=(io_uring_engine &&) = delete;
+  ~io_uring_engine() { close(); }
+
+  /*! Creates the ring with at least `entries` submission queue entries, and
+  `IORING_SETUP_*` flags `setup_flags`. Fails with `errc::function_not_supported`
+  if the kernel does not support `io_uring`, and `errc::operation_not_permitted`
+  if it has been disabled.
+
+  The flags supported are `IORING_SETUP_IOPOLL`, `IORING_SETUP_CLAMP`,
+  `IORING_SETUP_SUBMIT_ALL`, `IORING_SETUP_COOP_TASKRUN`,
+  `IORING_SETUP_TASKRUN_FLAG`, `IORING_SETUP_SINGLE_ISSUER` and
+  `IORING_SETUP_DEFER_TASKRUN`, those of them which the kernel headers define.
+  With `IORING_SETUP_IOPOLL` or `IORING_SETUP_DEFER_TASKRUN` completions only
+  become ready when waited for with `submit()` or `wait()`. Any other flag fails
+  with `errc::invalid_argument`, as it either needs parameters `open()` does not
+  take, such as `IORING_SETUP_CQSIZE` and `IORING_SETUP_ATTACH_WQ`, or changes
+  the layout of the rings, such as `IORING_SETUP_SQE128` and
+  `IORING_SETUP_NO_SQARRAY`, or needs other threads or calls this engine does
+  not make, such as `IORING_SETUP_SQPOLL` and `IORING_SETUP_R_DISABLED`.
+  */
+  result<void> open(unsigned entries = 256, unsigned setup_flags = 0) noexcept
+  {
+    if(_fd != -1)
+    {
+      return posix_code(EBUSY);
+    }
+    if((setup_flags & ~_supported_setup_flags()) != 0)
+    {
+      return posix_code(EINVAL);
+    }
+    io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    p.flags = setup_flags;
+    const long fd = detail::io_uring_syscall(SYS_io_uring_setup, entries, reinterpret_cast<long>(&p));
+    if(fd < 0)
+    {
+      return posix_code(static_cast<int>(-fd));
+    }
+    _fd = static_cast<int>(fd);
+    _sq_ring_bytes = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    _cq_ring_bytes = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    if((p.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+      _sq_ring_bytes = _cq_ring_bytes = (_sq_ring_bytes > _cq_ring_bytes) ? _sq_ring_bytes : _cq_ring_bytes;
+    }
+    auto r = _map(_sq_ring, _sq_ring_bytes, _fd, IORING_OFF_SQ_RING);
+    if(r.has_value())
+    {
+      if((p.features & IORING_FEAT_SINGLE_MMAP) != 0)
+      {
+        _cq_ring = _sq_ring;
+      }
+      else
+      {
+        r = _map(_cq_ring, _cq_ring_bytes, _fd, IORING_OFF_CQ_RING);
+      }
+    }
+    if(r.has_value())
+    {
+      _sqes_bytes = p.sq_entries * sizeof(io_uring_sqe);
+      void *sqes = nullptr;
+      r = _map(sqes, _sqes_bytes, _fd, IORING_OFF_SQES);
+      _sqes = static_cast<io_uring_sqe *>(sqes);
+    }
+    if(r.has_error())
+    {
+      close();
+      return r;
+    }
+    _sq_khead = _at<unsigned>(_sq_ring, p.sq_off.head);
+    _sq_ktail = _at<unsigned>(_sq_ring, p.sq_off.tail);
+    _sq_mask = *_at<unsigned>(_sq_ring, p.sq_off.ring_mask);
+    _sq_entries = p.sq_entries;
+    _cq_khead = _at<unsigned>(_cq_ring, p.cq_off.head);
+    _cq_ktail = _at<unsigned>(_cq_ring, p.cq_off.tail);
+    _cq_mask = *_at<unsigned>(_cq_ring, p.cq_off.ring_mask);
+    _cq_entries = p.cq_entries;
+    _cqes = _at<io_uring_cqe>(_cq_ring, p.cq_off.cqes);
+    // Entry n of the submission queue is always submission queue entry n
+    unsigned *array = _at<unsigned>(_sq_ring, p.sq_off.array);
+    for(unsigned n = 0; n < _sq_entries; n++)
+    {
+      array[n] = n;
+    }
+    _sq_tail = _sq_submitted = *_sq_ktail;
+    return result<void>(in_place_type<void>);
+  }
+  //! Destroys the ring. Operations in flight are cancelled by the kernel.
+  void close() noexcept
+  {
+    if(_sqes != nullptr)
+    {
+      ::munmap(_sqes, _sqes_bytes);
+    }
+    if(_cq_ring != nullptr && _cq_ring != _sq_ring)
+    {
+      ::munmap(_cq_ring, _cq_ring_bytes);
+    }
+    if(_sq_ring != nullptr)
+    {
+      ::munmap(_sq_ring, _sq_ring_bytes);
+    }
+    if(_fd != -1)
+    {
+      (void) posix_io::close(_fd);
+    }
+    _fd = -1;
+    _sq_ring = _cq_ring = nullptr;
+    _sqes = nullptr;
+    _sq_khead = _sq_ktail = _cq_khead = _cq_ktail = nullptr;
+    _cqes = nullptr;
+    _sq_mask = _sq_entries = _cq_mask = _cq_entries = 0;
+    _sq_tail = _sq_submitted = 0;
+  }
+  //! True if the ring has been created
+  bool is_open() const noexcept { return _fd != -1; }
+  //! The ring's file descriptor
+  int native_handle() const noexcept { return _fd; }
+  //! The number of submission queue entries
+  unsigned sq_entries() const noexcept { return _sq_entries; }
+  //! The number of completion queue entries
+  unsigned cq_entries() const noexcept { return _cq_entries; }
+
+  //! Returns the next free submission queue entry, zeroed, or null if the submission queue is full.
+  io_uring_sqe *get_sqe() noexcept
+  {
+    if(_sq_tail - __atomic_load_n(_sq_khead, __ATOMIC_ACQUIRE) >= _sq_entries)
+    {
+      return nullptr;
+    }
+    io_uring_sqe *sqe = &_sqes[_sq_tail & _sq_mask];
+    ++_sq_tail;
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+  }
+  //! The number of operations prepared but not yet submitted
+  unsigned pending() const noexcept { return _sq_tail - _sq_submitted; }
+
+  //! Prepares an operation which does nothing.
+  io_uring_sqe *prep_nop(uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_NOP, -1, nullptr, 0, 0, user_data, sqe_flags); }
+  //! Prepares a read of up to `bytes` into `buffer` from `offset`, or the current file position if `offset` is `(uint64_t) -1`.
+  io_uring_sqe *prep_read(int fd, void *buffer, uint32_t bytes, uint64_t offset, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_READ, fd, buffer, bytes, offset, user_data, sqe_flags); }
+  //! Prepares a write of up to `bytes` from `buffer` at `offset`, or the current file position if `offset` is `(uint64_t) -1`.
+  io_uring_sqe *prep_write(int fd, const void *buffer, uint32_t bytes, uint64_t offset, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_WRITE, fd, buffer, bytes, offset, user_data, sqe_flags); }
+  //! Prepares a scatter read into the `iovcnt` buffers `iov`, which must remain valid until submitted.
+  io_uring_sqe *prep_readv(int fd, const struct iovec *iov, unsigned iovcnt, uint64_t offset, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_READV, fd, iov, iovcnt, offset, user_data, sqe_flags); }
+  //! Prepares a gather write of the `iovcnt` buffers `iov`, which must remain valid until submitted.
+  io_uring_sqe *prep_writev(int fd, const struct iovec *iov, unsigned iovcnt, uint64_t offset, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_WRITEV, fd, iov, iovcnt, offset, user_data, sqe_flags); }
+  //! Prepares a read into `buffer`, which must lie within registered buffer `buffer_index`.
+  io_uring_sqe *prep_read_fixed(int fd, void *buffer, uint32_t bytes, uint64_t offset, uint16_t buffer_index, uint64_t user_data, uint8_t sqe_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_READ_FIXED, fd, buffer, bytes, offset, user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->buf_index = buffer_index;
+    }
+    return sqe;
+  }
+  //! Prepares a write from `buffer`, which must lie within registered buffer `buffer_index`.
+  io_uring_sqe *prep_write_fixed(int fd, const void *buffer, uint32_t bytes, uint64_t offset, uint16_t buffer_index, uint64_t user_data, uint8_t sqe_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_WRITE_FIXED, fd, buffer, bytes, offset, user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->buf_index = buffer_index;
+    }
+    return sqe;
+  }
+  //! Prepares a flush of the file to storage, of only its data if `fsync_flags` is `IORING_FSYNC_DATASYNC`.
+  io_uring_sqe *prep_fsync(int fd, uint64_t user_data, uint8_t sqe_flags = 0, uint32_t fsync_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_FSYNC, fd, nullptr, 0, 0, user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->fsync_flags = fsync_flags;
+    }
+    return sqe;
+  }
+  //! Prepares a close of the file descriptor.
+  io_uring_sqe *prep_close(int fd, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_CLOSE, fd, nullptr, 0, 0, user_data, sqe_flags); }
+  //! Prepares a receive of up to `bytes` into `buffer` from a socket, with `MSG_*` flags `msg_flags`.
+  io_uring_sqe *prep_recv(int fd, void *buffer, uint32_t bytes, uint64_t user_data, uint8_t sqe_flags = 0, int msg_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_RECV, fd, buffer, bytes, 0, user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->msg_flags = static_cast<uint32_t>(msg_flags);
+    }
+    return sqe;
+  }
+  //! Prepares a send of up to `bytes` from `buffer` to a socket, with `MSG_*` flags `msg_flags`.
+  io_uring_sqe *prep_send(int fd, const void *buffer, uint32_t bytes, uint64_t user_data, uint8_t sqe_flags = 0, int msg_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_SEND, fd, buffer, bytes, 0, user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->msg_flags = static_cast<uint32_t>(msg_flags);
+    }
+    return sqe;
+  }
+  //! Prepares an accept on a listening socket, whose completion's result is the new socket. `addr` and `addrlen` may be null.
+  io_uring_sqe *prep_accept(int fd, sockaddr *addr, socklen_t *addrlen, uint64_t user_data, uint8_t sqe_flags = 0, int accept_flags = 0) noexcept
+  {
+    io_uring_sqe *sqe = _prep(IORING_OP_ACCEPT, fd, addr, 0, reinterpret_cast<uintptr_t>(addrlen), user_data, sqe_flags);
+    if(sqe != nullptr)
+    {
+      sqe->accept_flags = static_cast<uint32_t>(accept_flags);
+    }
+    return sqe;
+  }
+  //! Prepares a connect of a socket to `addr`, which must remain valid until completion.
+  io_uring_sqe *prep_connect(int fd, const sockaddr *addr, socklen_t addrlen, uint64_t user_data, uint8_t sqe_flags = 0) noexcept { return _prep(IORING_OP_CONNECT, fd, addr, 0, addrlen, user_data, sqe_flags); }
+
+  /*! Passes all prepared operations to the kernel with one system call,
+  waiting for at least `wait_for` completions if it is not zero. Returns the
+  number of operations submitted.
+  */
+  result<unsigned> submit(unsigned wait_for = 0) noexcept
+  {
+    const unsigned to_submit = _sq_tail - _sq_submitted;
+    __atomic_store_n(_sq_ktail, _sq_tail, __ATOMIC_RELEASE);
+    if(to_submit == 0 && wait_for == 0)
+    {
+      return 0U;
+    }
+    const long ret = detail::io_uring_syscall(SYS_io_uring_enter, _fd, to_submit, wait_for, (wait_for > 0) ? IORING_ENTER_GETEVENTS : 0, 0, 0);
+    if(ret < 0)
+    {
+      return posix_code(static_cast<int>(-ret));
+    }
+    _sq_submitted += static_cast<unsigned>(ret);
+    return static_cast<unsigned>(ret);
+  }
+  //! Waits until at least `count` completions are ready to be reaped, submitting anything prepared.
+  result<void> wait(unsigned count = 1) noexcept
+  {
+    while(ready() < count)
+    {
+      auto r = submit(count - ready());
+      if(r.has_error() && r.error() != errc::interrupted)
+      {
+        return std::move(r).error();
+      }
+    }
+    return result<void>(in_place_type<void>);
+  }
+
+  //! The number of completions ready to be reaped
+  unsigned ready() const noexcept { return __atomic_load_n(_cq_ktail, __ATOMIC_ACQUIRE) - *_cq_khead; }
+  //! Calls `f(const completion &)` for each completion ready, then frees them, returning how many there were.
+  template <class F> unsigned for_each_completion(F &&f)
+  {
+    const unsigned head = *_cq_khead;
+    const unsigned tail = __atomic_load_n(_cq_ktail, __ATOMIC_ACQUIRE);
+    for(unsigned n = head; n != tail; n++)
+    {
+      const io_uring_cqe &cqe = _cqes[n & _cq_mask];
+      const completion c{cqe.user_data, cqe.res, cqe.flags};
+      f(c);
+    }
+    __atomic_store_n(_cq_khead, tail, __ATOMIC_RELEASE);
+    return tail - head;
+  }
+  //! Copies up to `max` ready completions into `out` and frees them, returning how many were copied.
+  unsigned reap(completion *out, unsigned max) noexcept
+  {
+    const unsigned head = *_cq_khead;
+    unsigned tail = __atomic_load_n(_cq_ktail, __ATOMIC_ACQUIRE);
+    if(tail - head > max)
+    {
+      tail = head + max;
+    }
+    for(unsigned n = head; n != tail; n++)
+    {
+      const io_uring_cqe &cqe = _cqes[n & _cq_mask];
+      out[n - head] = completion{cqe.user_data, cqe.res, cqe.flags};
+    }
+    __atomic_store_n(_cq_khead, tail, __ATOMIC_RELEASE);
+    return tail - head;
+  }
+
+  //! Registers `count` buffers for `prep_read_fixed()` and `prep_write_fixed()`, pinning their memory.
+  result<void> register_buffers(const struct iovec *buffers, unsigned count) noexcept { return _register(IORING_REGISTER_BUFFERS, buffers, count); }
+  //! Unregisters all registered buffers.
+  result<void> unregister_buffers() noexcept { return _register(IORING_UNREGISTER_BUFFERS, nullptr, 0); }
+  //! Registers `count` file descriptors, referred to by their index with `IOSQE_FIXED_FILE`.
+  result<void> register_files(const int *fds, unsigned count) noexcept { return _register(IORING_REGISTER_FILES, fds, count); }
+  //! Unregisters all registered files.
+  result<void> unregister_files() noexcept { return _register(IORING_UNREGISTER_FILES, nullptr, 0); }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
+
+#endif
@@ -25,10 +25,6 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef SYSTEM_ERROR2_NT_CODE_HPP
 #define SYSTEM_ERROR2_NT_CODE_HPP
 
-#if !defined(_WIN32) && !defined(STANDARDESE_IS_IN_THE_HOUSE)
-#error This file should only be included on Windows
-#endif
-
 #include "win32_code.hpp"
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
@@ -36,6 +32,7 @@ SYSTEM_ERROR2_NAMESPACE_BEGIN
 //! \exclude
 namespace win32
 {
+#ifdef _WIN32
   // A Win32 NTSTATUS
   using NTSTATUS = long;
   // A Win32 HMODULE
@@ -48,15 +45,22 @@ namespace win32
 #else
 #pragma comment(linker, "/alternatename:?GetModuleHandleW@win32@system_error2@@YGPAXPB_W@Z=__imp__GetModuleHandleW@4")
 #endif
+#else
+  // A Win32 NTSTATUS, as found in codes reported by Windows machines
+  using NTSTATUS = int32_t;
+#endif
 }  // namespace win32
 
 class _nt_code_domain;
-//! (Windows only) A NT error code, those returned by NT kernel functions.
+//! A NT error code, those returned by NT kernel functions.
 using nt_code = status_code<_nt_code_domain>;
-//! (Windows only) A specialisation of `status_error` for the NT error code domain.
+//! A specialisation of `status_error` for the NT error code domain.
 using nt_error = status_error<_nt_code_domain>;
 
-/*! (Windows only) The implementation of the domain for NT error codes, those returned by NT kernel functions.
+/*! The implementation of the domain for NT error codes, those returned by NT kernel functions.
+
+On platforms other than Windows, this domain decodes NT error codes reported
+by Windows machines, with messages from a compact embedded table.
  */
 class _nt_code_domain : public status_code_domain
 {
@@ -70,11 +74,7 @@ class _nt_code_domain : public status_code_domain
     {
       return 0;  // success
     }
-    switch(static_cast<unsigned>(c))
-    {
-#include "detail/nt_code_to_generic_code.ipp"
-    }
-    return -1;
+    return detail::nt_code_to_errno(static_cast<uint32_t>(c));
   }
   static win32::DWORD _nt_code_to_win32_code(win32::NTSTATUS c)  // NOLINT
   {
@@ -82,15 +82,14 @@ class _nt_code_domain : public status_code_domain
     {
       return 0;  // success
     }
-    switch(static_cast<unsigned>(c))
-    {
-#include "detail/nt_code_to_win32_code.ipp"
-    }
-    return static_cast<win32::DWORD>(-1);
+    return static_cast<win32::DWORD>(detail::nt_code_to_win32_code(static_cast<uint32_t>(c)));
   }
   //! Construct from a NT error code
   static _base::string_ref _make_string_ref(win32::NTSTATUS c) noexcept
   {
+#ifndef _WIN32
+    return detail::win32_code_embedded_message(detail::nt_code_message(static_cast<uint32_t>(c)), "unknown NT code ", static_cast<uint32_t>(c));
+#else
     wchar_t buffer[32768];
     static win32::HMODULE ntdll = win32::GetModuleHandleW(L"NTDLL.DLL");
     win32::DWORD wlen = win32::FormatMessageW(0x00000800 /*FORMAT_MESSAGE_FROM_HMODULE*/ | 0x00001000 /*FORMAT_MESSAGE_FROM_SYSTEM*/ | 0x00000200 /*FORMAT_MESSAGE_IGNORE_INSERTS*/, ntdll, c, (1 << 10) /*MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT)*/, buffer, 32768, nullptr);
@@ -126,6 +125,7 @@ class _nt_code_domain : public status_code_domain
       }
       return _base::string_ref("failed to get message from system");
     }
+#endif
   }
 
 public:
@@ -136,7 +136,7 @@ public:
 public:
   //! Default constructor
   constexpr explicit _nt_code_domain(typename _base::unique_id_type id = 0x93f3b4487e4af25b) noexcept
-      : _base(id)
+      : _base(id, _base::flag_trivially_erasable)
   {
   }
   _nt_code_domain(const _nt_code_domain &) = default;
@@ -203,8 +203,9 @@ protected:
   }
 #endif
 };
-//! (Windows only) A constexpr source variable for the NT code domain, which is that of NT kernel functions. Returned by `_nt_code_domain::get()`.
+//! A constexpr source variable for the NT code domain, which is that of NT kernel functions. Returned by `_nt_code_domain::get()`.
 constexpr _nt_code_domain nt_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(nt_code_domain);
 inline constexpr const _nt_code_domain &_nt_code_domain::get()
 {
   return nt_code_domain;
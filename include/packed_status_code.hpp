@@ -0,0 +1,272 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_PACKED_STATUS_CODE_HPP
+#define SYSTEM_ERROR2_PACKED_STATUS_CODE_HPP
+
+#include "status_code_wire.hpp"
+
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! The stable mapping between domain ids and the sixteen bit domain indices
+of `packed_status_code`.
+
+Indices 1 to 63 are fixed for the domains of this library, and mean the same
+in every build whichever headers it includes. Other domains are assigned the
+next free index from 64 upwards by `assign()`, the first time a code of theirs
+is packed with the dictionary. Store `ids()` alongside the packed data, and
+construct a dictionary from them to unpack it in another build.
+
+Not thread safe, other than concurrent use of the const member functions.
+*/
+class packed_status_code_dictionary
+{
+public:
+  //! The type of a domain id
+  using unique_id_type = status_code_domain::unique_id_type;
+  enum : uint16_t
+  {
+    //! The first index assigned to domains not of this library
+    first_assigned_index = 64
+  };
+
+private:
+  std::vector<unique_id_type> _ids;  // of indices from first_assigned_index
+
+  // Only ever appended to, as the indices of stored data must not change
+  static const unique_id_type *_builtin_ids(size_t &count) noexcept
+  {
+    static constexpr unique_id_type ids[] = {
+    0,                   // empty
+    0x746d6354f4f733e9,  // generic
+    0xa59a56fe5f310933,  // posix
+    0x8cd18ee72d680f1b,  // win32
+    0x93f3b4487e4af25b,  // nt
+    0xdc8275428b4effac,  // com
+    0x5b24b2de470ff7b6,  // getaddrinfo
+    0x3b5d7e9c1f2a4608,  // cancellation
+    };
+    count = sizeof(ids) / sizeof(ids[0]);
+    return ids;
+  }
+
+public:
+  //! Constructs a dictionary of only the fixed indices.
+  packed_status_code_dictionary() = default;
+  //! Constructs a dictionary from the `ids()` of another.
+  packed_status_code_dictionary(const unique_id_type *ids, size_t count)
+      : _ids(ids, ids + count)
+  {
+  }
+
+  //! The fixed index of the domain `id`, or zero if it has none.
+  static uint16_t fixed_index_of(unique_id_type id) noexcept
+  {
+    size_t count;
+    const unique_id_type *ids = _builtin_ids(count);
+    for(size_t n = 1; n < count; n++)
+    {
+      if(ids[n] == id)
+      {
+        return static_cast<uint16_t>(n);
+      }
+    }
+    return 0;
+  }
+  //! The index of the domain `id`, or zero if it has none.
+  uint16_t index_of(unique_id_type id) const noexcept
+  {
+    const uint16_t ret = fixed_index_of(id);
+    if(ret != 0)
+    {
+      return ret;
+    }
+    for(size_t n = 0; n < _ids.size(); n++)
+    {
+      if(_ids[n] == id)
+      {
+        return static_cast<uint16_t>(first_assigned_index + n);
+      }
+    }
+    return 0;
+  }
+  //! The index of the domain `id`, assigning the next free one if it has none. Returns zero if all are in use, or memory is exhausted.
+  uint16_t assign(unique_id_type id) noexcept
+  {
+    const uint16_t ret = index_of(id);
+    if(ret != 0 || _ids.size() >= 0xffffU - first_assigned_index)
+    {
+      return ret;
+    }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+    try
+    {
+      _ids.push_back(id);
+    }
+    catch(...)
+    {
+      return 0;
+    }
+#else
+    _ids.push_back(id);
+#endif
+    return static_cast<uint16_t>(first_assigned_index + _ids.size() - 1);
+  }
+  //! The id of the domain with `index`, or zero if there is none.
+  unique_id_type id_of(uint16_t index) const noexcept
+  {
+    size_t count;
+    const unique_id_type *ids = _builtin_ids(count);
+    if(index < count)
+    {
+      return ids[index];
+    }
+    if(index >= first_assigned_index && static_cast<size_t>(index - first_assigned_index) < _ids.size())
+    {
+      return _ids[index - first_assigned_index];
+    }
+    return 0;
+  }
+  //! The ids of the assigned indices, in index order from `first_assigned_index`.
+  const std::vector<unique_id_type> &ids() const noexcept { return _ids; }
+};
+
+/*! A status code packed into a single 64 bit word, for columnar storage and
+analytics. The top sixteen bits are the index of the code's domain in a
+`packed_status_code_dictionary`, or zero for an empty code, and the bottom 48
+bits are the code's value, two's complement. A zeroed word is thus an empty
+code, and codes can be grouped by domain with `bits() >> 48`.
+
+Domain indices are stable across builds. The domains of this library have
+fixed indices, so their codes need no dictionary. Codes of other domains are
+packed with a dictionary, which must be stored alongside the data.
+
+Codes which cannot be packed are stored as their generic code equivalent.
+These are codes of domains without an index, of domains whose value is not
+the whole of the code, and codes with values outside of 48 bits.
+*/
+class packed_status_code
+{
+  uint64_t _bits{0};
+
+  static constexpr uint64_t _value_mask = (static_cast<uint64_t>(1) << 48) - 1;
+  static constexpr uint64_t _value_sign = static_cast<uint64_t>(1) << 47;
+
+  static bool _packable(const status_code_domain &domain, intptr_t value) noexcept
+  {
+    const auto v = static_cast<int64_t>(value);
+    return v >= -static_cast<int64_t>(_value_sign) && v < static_cast<int64_t>(_value_sign) && detail::wire_codec::value_is_code(domain);
+  }
+  static uint64_t _pack(uint16_t index, intptr_t value) noexcept { return (index == 0) ? 0 : ((static_cast<uint64_t>(index) << 48) | (static_cast<uint64_t>(value) & _value_mask)); }
+  template <class F> void _init(const system_code &code, F &&index_of) noexcept
+  {
+    if(code.empty())
+    {
+      return;
+    }
+    if(_packable(code.domain(), code.value()))
+    {
+      _bits = _pack(index_of(code.domain().id()), code.value());
+    }
+    if(_bits == 0)
+    {
+      // The generic domain has a fixed index, and its values fit
+      const generic_code g = code.to_generic_code();
+      _bits = _pack(packed_status_code_dictionary::fixed_index_of(g.domain().id()), static_cast<intptr_t>(g.value()));
+    }
+    assert(_bits != 0);
+  }
+  static const status_code_domain *_find(status_code_domain::unique_id_type id) noexcept
+  {
+    // These are always linked in, even without a domain registry
+    if(id == generic_code_domain.id())
+    {
+      return &generic_code_domain;
+    }
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    if(id == posix_code_domain.id())
+    {
+      return &posix_code_domain;
+    }
+#endif
+    return status_code_domain_registry::find(id);
+  }
+
+public:
+  //! Default constructs an empty code.
+  packed_status_code() = default;
+  //! Converts from a system code, substituting the generic code equivalent for codes which cannot be packed without a dictionary.
+  explicit packed_status_code(const system_code &code) noexcept { _init(code, &packed_status_code_dictionary::fixed_index_of); }
+  //! Converts from a system code, assigning its domain an index in `dictionary` if needs be, substituting the generic code equivalent for codes which cannot be packed.
+  packed_status_code(const system_code &code, packed_status_code_dictionary &dictionary) noexcept
+  {
+    _init(code, [&dictionary](status_code_domain::unique_id_type id) { return dictionary.assign(id); });
+  }
+  //! Reconstitutes from the bits of a packed code.
+  static constexpr packed_status_code from_bits(uint64_t bits) noexcept { return packed_status_code(bits, 0); }
+
+  //! True if the code is empty.
+  constexpr bool empty() const noexcept { return _bits == 0; }
+  //! The packed bits.
+  constexpr uint64_t bits() const noexcept { return _bits; }
+  //! The index of the code's domain, which is zero if empty.
+  constexpr uint16_t domain_index() const noexcept { return static_cast<uint16_t>(_bits >> 48); }
+  //! The code's value, sign extended from 48 bits.
+  constexpr int64_t value() const noexcept { return static_cast<int64_t>((_bits & _value_mask) ^ _value_sign) - static_cast<int64_t>(_value_sign); }
+
+  //! Converts to a system code, using `dictionary` for domains without a fixed index. Returns an empty code if this is empty, or if the domain is unknown or not in this binary's registry.
+  system_code to_system_code(const packed_status_code_dictionary &dictionary) const noexcept
+  {
+    system_code ret;
+    if(!empty() && static_cast<int64_t>(static_cast<intptr_t>(value())) == value())
+    {
+      const auto id = dictionary.id_of(domain_index());
+      if(id != 0)
+      {
+        detail::wire_codec::rebuild(ret, _find(id), static_cast<intptr_t>(value()), nullptr, 0);
+      }
+    }
+    return ret;
+  }
+  //! Converts to a system code. Returns an empty code if this is empty, or if the domain has no fixed index or is not in this binary's registry.
+  system_code to_system_code() const noexcept { return to_system_code(packed_status_code_dictionary()); }
+
+  //! True if the bits are identical. This is not semantic equivalence, convert to `system_code` for that.
+  constexpr bool operator==(const packed_status_code &o) const noexcept { return _bits == o._bits; }
+  //! True if the bits differ.
+  constexpr bool operator!=(const packed_status_code &o) const noexcept { return _bits != o._bits; }
+
+private:
+  constexpr packed_status_code(uint64_t bits, int /*unused*/) noexcept
+      : _bits(bits)
+  {
+  }
+};
+static_assert(sizeof(packed_status_code) == sizeof(uint64_t), "packed_status_code is not a single 64 bit word");
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,109 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_PORTABLE_STATUS_CODE_HPP
+#define SYSTEM_ERROR2_PORTABLE_STATUS_CODE_HPP
+
+#include "status_code_wire.hpp"
+
+#include <type_traits>  // for is_trivially_copyable
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! A status code stored as its domain's unique id and its value, without any
+pointers, so it means the same in every process which has the domain registered
+with `status_code_domain_registry`. It is trivially copyable and sixteen bytes,
+so it can be placed directly into shared memory or mmapped queues, or be
+exchanged with a double width compare and swap where the target has one.
+
+Only codes whose value alone is the code can be represented, which are those of
+domains with `flag_trivially_erasable` and without `flag_has_wire_extension`.
+Other codes are stored as their generic code equivalent. Use `wire_encode()`
+for those instead if the domain implements a payload extension.
+*/
+class portable_status_code
+{
+  status_code_domain::unique_id_type _domain_id{0};
+  int64_t _value{0};
+
+public:
+  //! Default constructs an empty code.
+  portable_status_code() = default;
+  //! Explicitly constructs from a domain unique id and a value.
+  constexpr portable_status_code(status_code_domain::unique_id_type domain_id, int64_t value) noexcept
+      : _domain_id(domain_id)
+      , _value(value)
+  {
+  }
+  //! Converts from a system code, substituting the generic code equivalent for codes which are not portable.
+  explicit portable_status_code(const system_code &code) noexcept
+  {
+    if(code.empty())
+    {
+      return;
+    }
+    if(detail::wire_codec::value_is_code(code.domain()))
+    {
+      _domain_id = code.domain().id();
+      _value = static_cast<int64_t>(code.value());
+      return;
+    }
+    const generic_code g = code.to_generic_code();
+    _domain_id = g.domain().id();
+    _value = static_cast<int64_t>(g.value());
+  }
+
+  //! True if the code is empty.
+  constexpr bool empty() const noexcept { return _domain_id == 0; }
+  //! The unique id of the code's domain, zero if empty.
+  constexpr status_code_domain::unique_id_type domain_id() const noexcept { return _domain_id; }
+  //! The code's value, sign extended to 64 bits.
+  constexpr int64_t value() const noexcept { return _value; }
+
+  /*! Converts to a system code by looking up the domain id in `status_code_domain_registry`.
+  Returns an empty code if this is empty, if the domain is not registered in this
+  process, or if the value does not fit into `intptr_t`.
+  */
+  system_code to_system_code() const noexcept
+  {
+    system_code ret;
+    if(!empty() && _value >= static_cast<int64_t>(INTPTR_MIN) && _value <= static_cast<int64_t>(INTPTR_MAX))
+    {
+      detail::wire_codec::rebuild(ret, _domain_id, static_cast<intptr_t>(_value), nullptr, 0);
+    }
+    return ret;
+  }
+
+  //! True if both the domain ids and the values are identical. This is not semantic equivalence, convert to `system_code` for that.
+  constexpr bool operator==(const portable_status_code &o) const noexcept { return _domain_id == o._domain_id && _value == o._value; }
+  //! True if either the domain ids or the values differ.
+  constexpr bool operator!=(const portable_status_code &o) const noexcept { return !(*this == o); }
+};
+static_assert(sizeof(portable_status_code) == 16, "portable_status_code is not sixteen bytes");
+static_assert(std::is_trivially_copyable<portable_status_code>::value, "portable_status_code is not trivially copyable");
+static_assert(std::is_standard_layout<portable_status_code>::value, "portable_status_code is not standard layout");
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -92,7 +92,7 @@ public:
 
   //! Default constructor
   constexpr explicit _posix_code_domain(typename _base::unique_id_type id = 0xa59a56fe5f310933) noexcept
-      : _base(id)
+      : _base(id, _base::flag_trivially_erasable)
   {
   }
   _posix_code_domain(const _posix_code_domain &) = default;
@@ -136,6 +136,13 @@ protected:
     const auto &c = static_cast<const posix_code &>(code);  // NOLINT
     return generic_code(static_cast<errc>(c.value()));
   }
+  virtual void _do_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept override  // NOLINT
+  {
+    for(size_t n = 0; n < count; n++)
+    {
+      out[n] = static_cast<errc>(detail::erasure_cast<int>(values[n]));
+    }
+  }
   virtual string_ref _do_message(const status_code<void> &code) const noexcept override  // NOLINT
   {
     assert(code.domain() == *this);                         // NOLINT
@@ -153,6 +160,7 @@ protected:
 };
 //! A constexpr source variable for the POSIX code domain, which is that of `errno`. Returned by `_posix_code_domain::get()`.
 constexpr _posix_code_domain posix_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(posix_code_domain);
 inline constexpr const _posix_code_domain &_posix_code_domain::get()
 {
   return posix_code_domain;
@@ -0,0 +1,243 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_POSIX_IO_HPP
+#define SYSTEM_ERROR2_POSIX_IO_HPP
+
+#include "posix_code.hpp"
+#include "result.hpp"
+
+#if(__cplusplus >= 201703L || _HAS_CXX17) && __has_include(<variant>)
+
+#ifdef _WIN32
+#error Not available for Microsoft Windows
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#ifndef SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__)) && (defined(__GNUC__) || defined(__clang__))
+/*! Defined to 1 if `posix_io` makes system calls directly rather than via the C library.
+Usually automatic, can be overriden, for example to allow interposition of the C library's functions.
+*/
+#define SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS 1
+#else
+#define SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS 0
+#endif
+#endif
+
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+#include <sys/syscall.h>
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+  /* Makes system call `nr`, returning what the kernel returned, which on
+  failure is the negated error number. Unlike `syscall()`, `errno` is neither
+  written nor read, so there is no thread local storage access on any path.
+  */
+  inline long posix_io_syscall(long nr, long a = 0, long b = 0, long c = 0, long d = 0, long e = 0, long f = 0) noexcept
+  {
+#if defined(__x86_64__)
+    long ret;
+    register long r10 __asm__("r10") = d;
+    register long r8 __asm__("r8") = e;
+    register long r9 __asm__("r9") = f;
+    __asm__ volatile("syscall" : "=a"(ret) : "a"(nr), "D"(a), "S"(b), "d"(c), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+    return ret;
+#elif defined(__aarch64__)
+    register long x8 __asm__("x8") = nr;
+    register long x0 __asm__("x0") = a;
+    register long x1 __asm__("x1") = b;
+    register long x2 __asm__("x2") = c;
+    register long x3 __asm__("x3") = d;
+    register long x4 __asm__("x4") = e;
+    register long x5 __asm__("x5") = f;
+    __asm__ volatile("svc 0" : "+r"(x0) : "r"(x8), "r"(x1), "r"(x2), "r"(x3), "r"(x4), "r"(x5) : "memory", "cc");
+    return x0;
+#endif
+  }
+  // The kernel returns errors as -4095 to -1
+  template <class T> inline result<T> posix_io_result(long ret) noexcept
+  {
+    if(static_cast<unsigned long>(ret) > static_cast<unsigned long>(-4096))
+    {
+      return posix_code(static_cast<int>(-ret));
+    }
+    if constexpr(std::is_void_v<T>)
+    {
+      return result<void>(in_place_type<void>);
+    }
+    else
+    {
+      return static_cast<T>(ret);
+    }
+  }
+#else
+  // The C library returns errors as -1 with the error number in errno
+  template <class T, class U> inline result<T> posix_io_result(U ret) noexcept
+  {
+    if(ret == -1)
+    {
+      return posix_code::current();
+    }
+    if constexpr(std::is_void_v<T>)
+    {
+      return result<void>(in_place_type<void>);
+    }
+    else
+    {
+      return static_cast<T>(ret);
+    }
+  }
+#endif
+}  // namespace detail
+
+/*! The POSIX file i/o functions, returning `result<T>` with a `posix_code` on
+failure instead of setting `errno`, only available on C++ 17 or later.
+
+On Linux on x86-64 and AArch64 the system calls are made directly, and the
+kernel's negated error number returned is used without going through
+`errno`. Elsewhere, or if `SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS` is defined to
+0, the C library's functions are called and `errno` read only on failure.
+Direct system calls are not pthread cancellation points, and are not seen by
+anything interposing the C library's functions.
+
+Nothing is retried. In particular, `errc::interrupted` is returned as is, and
+`close()` must not be retried on failure as the descriptor is already closed.
+*/
+namespace posix_io
+{
+  //! Opens `path` with `flags`, creating it with `mode` if `flags` contains `O_CREAT`.
+  inline result<int> open(const char *path, int flags, mode_t mode = 0) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<int>(detail::posix_io_syscall(SYS_openat, AT_FDCWD, reinterpret_cast<long>(path), flags, mode));
+#else
+    return detail::posix_io_result<int>(::open(path, flags, mode));
+#endif
+  }
+  //! Reads up to `bytes` into `buffer` from the current file position, returning the bytes read.
+  inline result<size_t> read(int fd, void *buffer, size_t bytes) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_read, fd, reinterpret_cast<long>(buffer), static_cast<long>(bytes)));
+#else
+    return detail::posix_io_result<size_t>(::read(fd, buffer, bytes));
+#endif
+  }
+  //! Writes up to `bytes` from `buffer` at the current file position, returning the bytes written.
+  inline result<size_t> write(int fd, const void *buffer, size_t bytes) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_write, fd, reinterpret_cast<long>(buffer), static_cast<long>(bytes)));
+#else
+    return detail::posix_io_result<size_t>(::write(fd, buffer, bytes));
+#endif
+  }
+  //! Reads up to `bytes` into `buffer` from `offset`, returning the bytes read.
+  inline result<size_t> pread(int fd, void *buffer, size_t bytes, off_t offset) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_pread64, fd, reinterpret_cast<long>(buffer), static_cast<long>(bytes), static_cast<long>(offset)));
+#else
+    return detail::posix_io_result<size_t>(::pread(fd, buffer, bytes, offset));
+#endif
+  }
+  //! Writes up to `bytes` from `buffer` at `offset`, returning the bytes written.
+  inline result<size_t> pwrite(int fd, const void *buffer, size_t bytes, off_t offset) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_pwrite64, fd, reinterpret_cast<long>(buffer), static_cast<long>(bytes), static_cast<long>(offset)));
+#else
+    return detail::posix_io_result<size_t>(::pwrite(fd, buffer, bytes, offset));
+#endif
+  }
+  //! Reads into the `iovcnt` buffers `iov` from the current file position, returning the bytes read.
+  inline result<size_t> readv(int fd, const struct iovec *iov, int iovcnt) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_readv, fd, reinterpret_cast<long>(iov), iovcnt));
+#else
+    return detail::posix_io_result<size_t>(::readv(fd, iov, iovcnt));
+#endif
+  }
+  //! Writes the `iovcnt` buffers `iov` at the current file position, returning the bytes written.
+  inline result<size_t> writev(int fd, const struct iovec *iov, int iovcnt) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<size_t>(detail::posix_io_syscall(SYS_writev, fd, reinterpret_cast<long>(iov), iovcnt));
+#else
+    return detail::posix_io_result<size_t>(::writev(fd, iov, iovcnt));
+#endif
+  }
+  //! Flushes the file's data and metadata to storage.
+  inline result<void> fsync(int fd) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<void>(detail::posix_io_syscall(SYS_fsync, fd));
+#else
+    return detail::posix_io_result<void>(::fsync(fd));
+#endif
+  }
+  //! Closes the descriptor, which is closed even if a failure is returned.
+  inline result<void> close(int fd) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    return detail::posix_io_result<void>(detail::posix_io_syscall(SYS_close, fd));
+#else
+    return detail::posix_io_result<void>(::close(fd));
+#endif
+  }
+  //! Returns the file's status.
+  inline result<struct stat> fstat(int fd) noexcept
+  {
+    struct stat st;
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    // On these architectures the C library's struct stat is the kernel's
+    const long ret = detail::posix_io_syscall(SYS_fstat, fd, reinterpret_cast<long>(&st));
+#else
+    const int ret = ::fstat(fd, &st);
+#endif
+    auto r = detail::posix_io_result<void>(ret);
+    if(r.has_error())
+    {
+      return std::move(r).error();
+    }
+    return st;
+  }
+}  // namespace posix_io
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
+
+#endif
@@ -73,7 +73,7 @@ public:
   using _base::string_ref;
 
   constexpr _quick_status_code_from_enum_domain()
-      : status_code_domain(_src::domain_uuid, _uuid_size<detail::cstrlen(_src::domain_uuid)>())
+      : status_code_domain(_src::domain_uuid, _uuid_size<detail::cstrlen(_src::domain_uuid)>(), _base::flag_trivially_erasable)
   {
   }
   _quick_status_code_from_enum_domain(const _quick_status_code_from_enum_domain &) = default;
@@ -168,6 +168,20 @@ protected:
     }
     return errc::unknown;
   }
+  virtual void _do_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept override
+  {
+    // Batches tend to repeat the same few values, so remember the last lookup
+    const typename _src::mapping *mapping = nullptr;
+    for(size_t n = 0; n < count; n++)
+    {
+      const auto v = detail::erasure_cast<value_type>(values[n]);
+      if(mapping == nullptr || mapping->value != v)
+      {
+        mapping = _find_mapping(v);
+      }
+      out[n] = (mapping != nullptr && mapping->code_mappings.size() > 0) ? *mapping->code_mappings.begin() : errc::unknown;
+    }
+  }
   virtual string_ref _do_message(const status_code<void> &code) const noexcept override
   {
     assert(code.domain() == *this);  // NOLINT
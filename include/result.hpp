@@ -380,6 +380,36 @@ public:
   }
 };
 
+namespace traits
+{
+  /* All the major standard libraries store the alternatives of a std::variant
+  inline next to its index, with nothing pointing into itself, so a result is
+  bitcopy relocatable if its value type is.
+  */
+  template <class T> struct is_bitcopy_relocatable<result<T>>
+  {
+    static constexpr bool value = is_bitcopy_relocatable<detail::devoid<T>>::value;
+  };
+}  // namespace traits
+
+namespace detail
+{
+  template <class T> struct bulk_destroy<result<T>>
+  {
+    static void destroy(result<T> &v) noexcept
+    {
+      if(auto *e = std::get_if<0>(&v._internal()))
+      {
+        bulk_destroy<SYSTEM_ERROR2_NAMESPACE::error>::destroy(*e);
+      }
+      else if(auto *x = std::get_if<1>(&v._internal()))
+      {
+        bulk_destroy<devoid<T>>::destroy(*x);
+      }
+    }
+  };
+}  // namespace detail
+
 //! True if the two results compare equal.
 template <class T, class U, typename = decltype(std::declval<T>() == std::declval<U>())> constexpr inline bool operator==(const result<T> &a, const result<U> &b) noexcept
 {
@@ -243,6 +243,8 @@ public:
   for the equivalent generic code and those are compared.
   */
   template <class T> inline bool equivalent(const status_code<T> &o) const noexcept;
+  //! Returns the generic code which the domain says is closest to this code, which is `errc::unknown` if there is none. Empty if this code is empty.
+  inline generic_code to_generic_code() const noexcept;
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   //! Throw a code as a C++ exception.
   SYSTEM_ERROR2_NORETURN void throw_exception() const
@@ -563,6 +565,20 @@ namespace traits
   };
 }  // namespace traits
 
+namespace detail
+{
+  template <class ErasedType> struct bulk_destroy<status_code<erased<ErasedType>>>
+  {
+    static void destroy(status_code<erased<ErasedType>> &v) noexcept
+    {
+      if(!v.empty() && (v.domain().flags() & status_code_domain::flag_trivially_erasable) == 0)
+      {
+        v.~status_code();
+      }
+    }
+  };
+}  // namespace detail
+
 SYSTEM_ERROR2_NAMESPACE_END
 
 #endif
@@ -0,0 +1,226 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_COLUMN_STORE_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_COLUMN_STORE_HPP
+
+#include "bitcopy_vector.hpp"
+#include "status_code_wire.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! A store of many system codes, held column wise as a column of domain
+pointers and a column of values, for bulk queries over recorded outcomes.
+
+The queries handle codes of the generic and POSIX domains, whose values are
+errno values, without calling their domains at all. The loops doing so are
+branch free over both columns so that the compiler can vectorise them. Codes of
+any other domain are handled afterwards, by calling their domain as usual.
+
+Only codes whose value is the whole of the code are stored as they are, which
+are those of domains with `status_code_domain::flag_trivially_erasable` and
+without `status_code_domain::flag_has_wire_extension`. Other codes are stored
+as their generic code equivalent.
+*/
+class status_code_column_store
+{
+  bitcopy_vector<const status_code_domain *> _domains;
+  bitcopy_vector<intptr_t> _values;
+  // Nonzero if the domain's values are errno values, decided when appended so that queries need not look at domains
+  bitcopy_vector<unsigned char> _errno_values;
+
+  /* True if the values of `domain` are errno values, where zero is success.
+  Domains are compared by id, as each translation unit and shared object may
+  have its own copy of a domain.
+  */
+  static bool _is_errno_domain(const status_code_domain *domain) noexcept
+  {
+    return domain != nullptr && (domain->id() == generic_code_domain.id()
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+                                 || domain->id() == posix_code_domain.id()
+#endif
+                                );
+  }
+  // True if `a` and `b` are the same domain, or both null
+  static bool _same_domain(const status_code_domain *a, const status_code_domain *b) noexcept { return a == b || (a != nullptr && b != nullptr && a->id() == b->id()); }
+
+public:
+  //! The number of codes of one domain, as returned by `group_by_domain()`.
+  struct domain_count
+  {
+    //! The domain, null for empty codes.
+    const status_code_domain *domain;
+    //! The number of codes of that domain.
+    size_t count;
+  };
+
+  //! Default constructor
+  status_code_column_store() = default;
+
+  //! True if there are no codes stored.
+  bool empty() const noexcept { return _values.empty(); }
+  //! The number of codes stored.
+  size_t size() const noexcept { return _values.size(); }
+  //! The column of domains, null for empty codes.
+  const status_code_domain *const *domains() const noexcept { return _domains.data(); }
+  //! The column of values.
+  const intptr_t *values() const noexcept { return _values.data(); }
+  //! Returns the code at `n`.
+  system_code operator[](size_t n) const noexcept
+  {
+    system_code ret;
+    if(_domains[n] != nullptr)
+    {
+      detail::wire_codec::rebuild(ret, _domains[n], _values[n], nullptr, 0);
+    }
+    return ret;
+  }
+
+  //! Reserves space for `n` codes.
+  void reserve(size_t n)
+  {
+    _domains.reserve(n);
+    _values.reserve(n);
+    _errno_values.reserve(n);
+  }
+  //! Appends a code, storing its generic code equivalent if its value is not the whole of the code.
+  void push_back(const system_code &code)
+  {
+    const status_code_domain *domain = nullptr;
+    intptr_t value = 0;
+    if(!code.empty())
+    {
+      if(detail::wire_codec::value_is_code(code.domain()))
+      {
+        domain = &code.domain();
+        value = code.value();
+      }
+      else
+      {
+        domain = &generic_code_domain;
+        value = static_cast<intptr_t>(code.to_generic_code().value());
+      }
+    }
+    if(_domains.size() == _domains.capacity() || _values.size() == _values.capacity() || _errno_values.size() == _errno_values.capacity())
+    {
+      // Grow all columns geometrically before appending to any, so a failure to allocate leaves them the same length
+      const size_t capacity = 2 * _values.capacity();
+      reserve((capacity > _values.size()) ? capacity : _values.size() + 1);
+    }
+    _domains.push_back(static_cast<const status_code_domain *&&>(domain));
+    _values.push_back(static_cast<intptr_t &&>(value));
+    _errno_values.push_back(static_cast<unsigned char>(_is_errno_domain(domain)));
+  }
+  //! Removes all codes.
+  void clear() noexcept
+  {
+    _domains.clear();
+    _values.clear();
+    _errno_values.clear();
+  }
+
+  //! The number of codes for which `failure()` is true.
+  size_t count_failures() const noexcept
+  {
+    const status_code_domain *const *d = _domains.data();
+    const intptr_t *v = _values.data();
+    const unsigned char *e = _errno_values.data();
+    const size_t count = size();
+    size_t ret = 0, others = 0;
+    for(size_t n = 0; n < count; n++)
+    {
+      const bool known = e[n] != 0;
+      ret += static_cast<size_t>(known & (v[n] != 0));
+      others += static_cast<size_t>(!known & (d[n] != nullptr));
+    }
+    for(size_t n = 0; others > 0 && n < count; n++)
+    {
+      if(d[n] != nullptr && e[n] == 0)
+      {
+        ret += static_cast<size_t>((*this)[n].failure());
+        --others;
+      }
+    }
+    return ret;
+  }
+  //! The number of codes which are semantically equivalent to `c`.
+  size_t count_equivalent(errc c) const noexcept
+  {
+    const status_code_domain *const *d = _domains.data();
+    const intptr_t *v = _values.data();
+    const unsigned char *e = _errno_values.data();
+    const size_t count = size();
+    const auto cv = static_cast<intptr_t>(c);
+    size_t ret = 0, others = 0;
+    for(size_t n = 0; n < count; n++)
+    {
+      const bool known = e[n] != 0;
+      ret += static_cast<size_t>(known & (v[n] == cv));
+      others += static_cast<size_t>(!known & (d[n] != nullptr));
+    }
+    const generic_code g(c);
+    for(size_t n = 0; others > 0 && n < count; n++)
+    {
+      if(d[n] != nullptr && e[n] == 0)
+      {
+        ret += static_cast<size_t>((*this)[n] == g);
+        --others;
+      }
+    }
+    return ret;
+  }
+  //! The number of codes of each domain, by domain id, in the order each domain first appears.
+  bitcopy_vector<domain_count> group_by_domain() const
+  {
+    bitcopy_vector<domain_count> ret;
+    const status_code_domain *const *d = _domains.data();
+    const size_t count = size();
+    for(size_t n = 0; n < count;)
+    {
+      // Codes of the same domain tend to be recorded together, so count runs
+      size_t m = n + 1;
+      while(m < count && _same_domain(d[m], d[n]))
+      {
+        ++m;
+      }
+      domain_count *it = ret.begin();
+      while(it != ret.end() && !_same_domain(it->domain, d[n]))
+      {
+        ++it;
+      }
+      if(it == ret.end())
+      {
+        ret.push_back(domain_count{d[n], 0});
+        it = ret.end() - 1;
+      }
+      it->count += m - n;
+      n = m;
+    }
+    return ret;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
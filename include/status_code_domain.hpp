@@ -27,6 +27,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "config.hpp"
 
+#include <cstdint>  // for uint64_t
 #include <cstring>  // for strchr
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
@@ -36,10 +37,11 @@ SYSTEM_ERROR2_NAMESPACE_BEGIN
 Be careful of placing these into containers! Equality and inequality operators are
 *semantic* not exact. Therefore two distinct items will test true! To help prevent
 surprise on this, `operator<` and `std::hash<>` are NOT implemented in order to
-trap potential incorrectness. Define your own custom comparison functions for your
-container which perform exact comparisons.
+trap potential incorrectness. Use `exact_hash`, `exact_equal` and `exact_less`
+from `status_code_exact.hpp` for your container, which perform exact comparisons.
 */
 template <class DomainType> class status_code;
+enum class errc : int;
 class _generic_code_domain;
 //! The generic code is a status code with the generic code domain, which is that of `errc` (POSIX).
 using generic_code = status_code<_generic_code_domain>;
@@ -47,6 +49,8 @@ using generic_code = status_code<_generic_code_domain>;
 namespace detail
 {
   template <class StatusCode> class indirecting_domain;
+  struct exact_comparison;
+  struct wire_codec;
   template <class T> struct status_code_sizer
   {
     void *a;
@@ -88,6 +92,57 @@ namespace detail
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
+
+  /* Exact hashing and comparison of the bits of a value. Missing trailing bytes
+  compare as zero, so a typed code and its erased form, whose padding is zeroed,
+  hash and compare the same.
+  */
+  inline uint64_t exact_hash_mix(uint64_t h) noexcept
+  {
+    // The finaliser of MurmurHash3, where every input bit affects every output bit
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+  inline uint64_t exact_value_word(const void *value, size_t bytes, size_t idx) noexcept
+  {
+    uint64_t w = 0;
+    if(idx * 8 < bytes)
+    {
+      const size_t remaining = bytes - idx * 8;
+      memcpy(&w, static_cast<const char *>(value) + idx * 8, (remaining < 8) ? remaining : 8);
+    }
+    return w;
+  }
+  inline size_t exact_hash_bytes(unsigned long long id, const void *value, size_t bytes) noexcept
+  {
+    uint64_t h = id;
+    for(size_t idx = 0; idx * 8 < bytes; idx++)
+    {
+      const uint64_t w = exact_value_word(value, bytes, idx);
+      if(w != 0)
+      {
+        h ^= exact_hash_mix(w + idx * 0x9e3779b97f4a7c15ULL);
+      }
+    }
+    return static_cast<size_t>(exact_hash_mix(h));
+  }
+  inline int exact_compare_bytes(const void *value1, size_t bytes1, const void *value2, size_t bytes2) noexcept
+  {
+    const size_t bytes = (bytes1 > bytes2) ? bytes1 : bytes2;
+    for(size_t idx = 0; idx * 8 < bytes; idx++)
+    {
+      const uint64_t w1 = exact_value_word(value1, bytes1, idx), w2 = exact_value_word(value2, bytes2, idx);
+      if(w1 != w2)
+      {
+        return (w1 < w2) ? -1 : 1;
+      }
+    }
+    return 0;
+  }
   static constexpr unsigned long long test_uuid_parse = parse_uuid_from_array("430f1201-94fc-06c7-430f-120194fc06c7");
   //static constexpr unsigned long long test_uuid_parse2 = parse_uuid_from_array("x30f1201-94fc-06c7-430f-120194fc06c7");
 }  // namespace detail
@@ -98,10 +153,22 @@ class status_code_domain
 {
   template <class DomainType> friend class status_code;
   template <class StatusCode> friend class indirecting_domain;
+  friend struct detail::exact_comparison;
+  friend struct detail::wire_codec;
 
 public:
   //! Type of the unique id for this domain.
   using unique_id_type = unsigned long long;
+  //! Type of the bit flags describing properties of this domain which can be queried without a virtual call.
+  using flags_type = unsigned;
+  //! The bit flags which a domain may set.
+  enum flag_bits : flags_type
+  {
+    //! `_do_erased_destroy()` does nothing for this domain, so bulk destruction of erased codes may skip calling it.
+    flag_trivially_erasable = 1U << 0,
+    //! `_do_wire_extension()` is implemented, so wire encoding calls it to append a payload extension.
+    flag_has_wire_extension = 1U << 1
+  };
   /*! (Potentially thread safe) Reference to a message string.
 
   Be aware that you cannot add payload to implementations of this class.
@@ -340,21 +407,24 @@ public:
 
 private:
   unique_id_type _id;
+  flags_type _flags;
 
 protected:
   /*! Use [https://www.random.org/cgi-bin/randbyte?nbytes=8&format=h](https://www.random.org/cgi-bin/randbyte?nbytes=8&format=h) to get a random 64 bit id.
 
   Do NOT make up your own value. Do NOT use zero.
   */
-  constexpr explicit status_code_domain(unique_id_type id) noexcept
+  constexpr explicit status_code_domain(unique_id_type id, flags_type domain_flags = 0) noexcept
       : _id(id)
+      , _flags(domain_flags)
   {
   }
   /*! UUID constructor, where input is constexpr parsed into a `unique_id_type`.
    */
   template <size_t N>
-  constexpr explicit status_code_domain(const char (&uuid)[N]) noexcept
+  constexpr explicit status_code_domain(const char (&uuid)[N], flags_type domain_flags = 0) noexcept
       : _id(detail::parse_uuid_from_array<N>(uuid))
+      , _flags(domain_flags)
   {
   }
   template <size_t N> struct _uuid_size
@@ -362,8 +432,9 @@ protected:
   };
   //! Alternative UUID constructor
   template <size_t N>
-  constexpr explicit status_code_domain(const char *uuid, _uuid_size<N> /*unused*/) noexcept
+  constexpr explicit status_code_domain(const char *uuid, _uuid_size<N> /*unused*/, flags_type domain_flags = 0) noexcept
       : _id(detail::parse_uuid_from_pointer<N>(uuid))
+      , _flags(domain_flags)
   {
   }
   //! No public copying at type erased level
@@ -387,8 +458,15 @@ public:
 
   //! Returns the unique id used to identify identical category instances.
   constexpr unique_id_type id() const noexcept { return _id; }
+  //! Returns the `flag_bits` set by this domain.
+  constexpr flags_type flags() const noexcept { return _flags; }
   //! Name of this category.
   virtual string_ref name() const noexcept = 0;
+  /*! Writes into `out` the generic code closest to each of `count` codes of this
+  domain, whose values as erased into a `system_code` are at `values`. Equivalent
+  to, but much faster than, calling `to_generic_code()` on each code.
+  */
+  void to_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept { _do_generic_codes(out, values, count); }
 
 protected:
   //! True if code means failure.
@@ -414,8 +492,54 @@ protected:
     (void) code;
     (void) bytes;
   }
+  // For `exact_hash`, hash the bits of the value of `code`, which are at `value`. Default implementation hashes the domain id and the bits.
+  virtual size_t _do_exact_hash(const status_code<void> &code, const void *value, size_t bytes) const noexcept  // NOLINT
+  {
+    (void) code;
+    return detail::exact_hash_bytes(_id, value, bytes);
+  }
+  // For `exact_equal` and `exact_less`, order two codes of this domain, returning less than, equal to or more than zero. Default implementation compares the bits.
+  virtual int _do_exact_compare(const status_code<void> &code1, const void *value1, size_t bytes1, const status_code<void> &code2, const void *value2, size_t bytes2) const noexcept  // NOLINT
+  {
+    (void) code1;
+    (void) code2;
+    return detail::exact_compare_bytes(value1, bytes1, value2, bytes2);
+  }
+  // For wire encoding, if `flag_has_wire_extension` is set, write the payload extension for `code` into `buffer` of `bytes`, returning its length even if too long to fit. Default implementation has none.
+  virtual size_t _do_wire_extension(const status_code<void> &code, void *buffer, size_t bytes) const noexcept  // NOLINT
+  {
+    (void) code;
+    (void) buffer;
+    (void) bytes;
+    return 0;
+  }
+  // For wire decoding, construct into the empty erased code `dst` of `bytes` the code for `value` and the payload `extension`. Only called for domains without `flag_trivially_erasable`, or with an extension. Default implementation fails.
+  virtual bool _do_wire_decode(status_code<void> &dst, size_t bytes, intptr_t value, const void *extension, size_t extension_bytes) const noexcept  // NOLINT
+  {
+    (void) dst;
+    (void) bytes;
+    (void) value;
+    (void) extension;
+    (void) extension_bytes;
+    return false;
+  }
+  // For `to_generic_codes()`, write into `out` the closest generic code to each of `count` values erased into `intptr_t`. Default implementation calls `_generic_code()` for each if `flag_trivially_erasable` is set, else writes `errc::unknown`.
+  inline virtual void _do_generic_codes(errc *out, const intptr_t *values, size_t count) const noexcept;  // NOLINT
 };
 
+#ifdef SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_CONCAT2(a, b) a##b
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_CONCAT(a, b) SYSTEM_ERROR2_DOMAIN_REGISTRY_CONCAT2(a, b)
+/*! Registers the constexpr domain variable `domain` with the domain registry in
+`status_code_domain_registry.hpp`. Use at namespace scope. This places a pointer
+to the domain into a dedicated linker section, so costs no static initialiser.
+*/
+#define SYSTEM_ERROR2_REGISTER_DOMAIN(domain)                                                                                                                                                                                                                                                                                  \
+  SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY static const ::SYSTEM_ERROR2_NAMESPACE::status_code_domain *const SYSTEM_ERROR2_DOMAIN_REGISTRY_CONCAT(system_error2_domain_registration_, __COUNTER__) = &(domain)
+#else
+#define SYSTEM_ERROR2_REGISTER_DOMAIN(domain) static_assert(true, "")
+#endif
+
 SYSTEM_ERROR2_NAMESPACE_END
 
 #endif
@@ -0,0 +1,177 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_DOMAIN_REGISTRY_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_DOMAIN_REGISTRY_HPP
+
+#include "status_code_domain.hpp"
+
+#include <algorithm>  // for sort
+#include <atomic>
+
+#ifdef SYSTEM_ERROR2_DOMAIN_REGISTRY_ENTRY
+#if defined(_MSC_VER) && !defined(__clang__)
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+namespace detail
+{
+  __declspec(allocate(".se2dom$a")) __declspec(selectany) extern const status_code_domain *const domain_registry_begin = nullptr;
+  __declspec(allocate(".se2dom$z")) __declspec(selectany) extern const status_code_domain *const domain_registry_end = nullptr;
+}  // namespace detail
+SYSTEM_ERROR2_NAMESPACE_END
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_BEGIN (&::SYSTEM_ERROR2_NAMESPACE::detail::domain_registry_begin + 1)
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_END (&::SYSTEM_ERROR2_NAMESPACE::detail::domain_registry_end)
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_LOCAL
+#elif defined(__APPLE__)
+extern "C" const SYSTEM_ERROR2_NAMESPACE::status_code_domain *const system_error2_domain_registry_begin[] __asm("section$start$__DATA$__se2_domains");
+extern "C" const SYSTEM_ERROR2_NAMESPACE::status_code_domain *const system_error2_domain_registry_end[] __asm("section$end$__DATA$__se2_domains");
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_BEGIN system_error2_domain_registry_begin
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_END system_error2_domain_registry_end
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_LOCAL __attribute__((visibility("hidden")))
+#else
+// Generated by the linker for each executable and shared object, and null if it has no registered domains
+extern "C" const SYSTEM_ERROR2_NAMESPACE::status_code_domain *const __start_system_error2_domains[] __attribute__((weak, visibility("hidden")));  // NOLINT
+extern "C" const SYSTEM_ERROR2_NAMESPACE::status_code_domain *const __stop_system_error2_domains[] __attribute__((weak, visibility("hidden")));   // NOLINT
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_BEGIN __start_system_error2_domains
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_END __stop_system_error2_domains
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_LOCAL __attribute__((visibility("hidden")))
+#endif
+#else
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_LOCAL
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! The domains registered with `SYSTEM_ERROR2_REGISTER_DOMAIN()`, which
+includes all the built-in domains with a constexpr domain variable, sorted by
+unique id.
+
+Registration places a pointer to the domain into a dedicated linker section,
+so there are no static initialisers, and loading a binary costs nothing extra.
+The index for lookup by unique id is built lazily by the first use, and is then
+lock free.
+
+Each executable and shared object has its own registry, holding the domains
+registered within it. On platforms without a usable linker section, the
+registry is always empty.
+*/
+class SYSTEM_ERROR2_DOMAIN_REGISTRY_LOCAL status_code_domain_registry
+{
+  struct _index
+  {
+    size_t count;
+    const status_code_domain **domains;
+  };
+
+  static _index *_build() noexcept
+  {
+#ifdef SYSTEM_ERROR2_DOMAIN_REGISTRY_BEGIN
+    const status_code_domain *const *begin = SYSTEM_ERROR2_DOMAIN_REGISTRY_BEGIN, *const *end = SYSTEM_ERROR2_DOMAIN_REGISTRY_END;
+    const size_t entries = (begin != nullptr && end != nullptr) ? static_cast<size_t>(end - begin) : 0;
+#else
+    const status_code_domain *const *begin = nullptr;
+    const size_t entries = 0;
+#endif
+    auto *ret = static_cast<_index *>(malloc(sizeof(_index) + entries * sizeof(const status_code_domain *)));  // NOLINT
+    if(ret == nullptr)
+    {
+      return nullptr;
+    }
+    ret->count = 0;
+    ret->domains = reinterpret_cast<const status_code_domain **>(ret + 1);  // NOLINT
+    for(size_t n = 0; n < entries; n++)
+    {
+      // The linker may pad the section with zeros
+      if(begin[n] != nullptr)
+      {
+        ret->domains[ret->count++] = begin[n];
+      }
+    }
+    // Every translation unit registering a domain contributes an entry for it, so remove the duplicates
+    std::sort(ret->domains, ret->domains + ret->count, [](const status_code_domain *a, const status_code_domain *b) { return a->id() < b->id(); });
+    ret->count = std::unique(ret->domains, ret->domains + ret->count, [](const status_code_domain *a, const status_code_domain *b) { return a->id() == b->id(); }) - ret->domains;
+    return ret;
+  }
+  static const _index &_get() noexcept
+  {
+    static const _index empty = {0, nullptr};
+    static std::atomic<_index *> index{nullptr};
+    _index *ret = index.load(std::memory_order_acquire);
+    if(ret == nullptr)
+    {
+      _index *built = _build();
+      if(built == nullptr)
+      {
+        return empty;
+      }
+      if(index.compare_exchange_strong(ret, built, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        ret = built;
+      }
+      else
+      {
+        free(built);  // NOLINT
+      }
+    }
+    return *ret;
+  }
+
+public:
+  //! The type of iterator over the registered domains
+  using const_iterator = const status_code_domain *const *;
+
+  //! Iterator to the registered domain with the lowest unique id
+  static const_iterator begin() noexcept { return _get().domains; }
+  //! Iterator to after the registered domain with the highest unique id
+  static const_iterator end() noexcept { return _get().domains + _get().count; }
+  //! The number of registered domains
+  static size_t size() noexcept { return _get().count; }
+
+  //! Returns the registered domain with unique id `id`, or null if there is none.
+  static const status_code_domain *find(status_code_domain::unique_id_type id) noexcept
+  {
+    const _index &idx = _get();
+    const status_code_domain *const *it = std::lower_bound(idx.domains, idx.domains + idx.count, id, [](const status_code_domain *a, status_code_domain::unique_id_type b) { return a->id() < b; });
+    return (it != idx.domains + idx.count && (*it)->id() == id) ? *it : nullptr;
+  }
+  /*! Returns the position within the registry of the domain with unique id `id`,
+  or `size()` if there is none. Positions are dense, and are the same in every
+  binary with the same set of registered domains.
+  */
+  static size_t index_of(status_code_domain::unique_id_type id) noexcept
+  {
+    const _index &idx = _get();
+    const status_code_domain *const *it = std::lower_bound(idx.domains, idx.domains + idx.count, id, [](const status_code_domain *a, status_code_domain::unique_id_type b) { return a->id() < b; });
+    return (it != idx.domains + idx.count && (*it)->id() == id) ? static_cast<size_t>(it - idx.domains) : idx.count;
+  }
+  //! Returns the registered domain at position `n`, or null if there is none.
+  static const status_code_domain *at(size_t n) noexcept
+  {
+    const _index &idx = _get();
+    return (n < idx.count) ? idx.domains[n] : nullptr;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,149 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_EXACT_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_EXACT_HPP
+
+#include "status_code.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  struct exact_comparison
+  {
+    // Typed codes hand out their value by reference
+    template <class DomainType> static const void *value_bits(const status_code<DomainType> &code, void * /*unused*/) noexcept { return static_cast<const void *>(&code.value()); }
+    // Erased codes hand out their value by value, so it is copied into `buffer`
+    template <class ErasedType> static const void *value_bits(const status_code<erased<ErasedType>> &code, void *buffer) noexcept
+    {
+      const ErasedType v = code.value();
+      memcpy(buffer, static_cast<const void *>(&v), sizeof(v));
+      return buffer;
+    }
+    /* Integral values narrower than intptr_t are widened as erasure into a
+    system_code widens them, sign extending signed values, so that typed and
+    erased codes compare the same bits.
+    */
+    template <class V> using normal_type = typename std::conditional<(std::is_integral<V>::value || std::is_enum<V>::value) && (sizeof(V) < sizeof(intptr_t)), intptr_t, V>::type;
+    template <class V, typename std::enable_if<std::is_same<normal_type<V>, V>::value, bool>::type = true> static const void *normal_bits(const void *bits, void * /*unused*/) noexcept { return bits; }
+    template <class V, typename std::enable_if<!std::is_same<normal_type<V>, V>::value, bool>::type = true> static const void *normal_bits(const void *bits, void *buffer) noexcept
+    {
+      V v;
+      memcpy(static_cast<void *>(&v), bits, sizeof(v));
+      const intptr_t w = erasure_cast<intptr_t>(v);
+      memcpy(buffer, static_cast<const void *>(&w), sizeof(w));
+      return buffer;
+    }
+
+    template <class T> static size_t hash(const T &code) noexcept
+    {
+      using value_type = typename T::value_type;
+      if(code.empty())
+      {
+        return 0;
+      }
+      alignas(value_type) char buffer[sizeof(value_type)];
+      const void *v = value_bits(code, buffer);
+      const status_code_domain &d = code.domain();
+      if((d.flags() & status_code_domain::flag_trivially_erasable) != 0)
+      {
+        alignas(normal_type<value_type>) char normal[sizeof(normal_type<value_type>)];
+        return exact_hash_bytes(d._id, normal_bits<value_type>(v, normal), sizeof(normal));
+      }
+      return d._do_exact_hash(code, v, sizeof(value_type));
+    }
+    template <class T, class U> static int compare(const T &a, const U &b) noexcept
+    {
+      using value_type1 = typename T::value_type;
+      using value_type2 = typename U::value_type;
+      if(a.empty() || b.empty())
+      {
+        return static_cast<int>(!a.empty()) - static_cast<int>(!b.empty());
+      }
+      const status_code_domain &d1 = a.domain(), &d2 = b.domain();
+      if(d1._id != d2._id)
+      {
+        return (d1._id < d2._id) ? -1 : 1;
+      }
+      alignas(value_type1) char buffer1[sizeof(value_type1)];
+      alignas(value_type2) char buffer2[sizeof(value_type2)];
+      const void *v1 = value_bits(a, buffer1), *v2 = value_bits(b, buffer2);
+      if((d1.flags() & status_code_domain::flag_trivially_erasable) != 0)
+      {
+        alignas(normal_type<value_type1>) char normal1[sizeof(normal_type<value_type1>)];
+        alignas(normal_type<value_type2>) char normal2[sizeof(normal_type<value_type2>)];
+        return exact_compare_bytes(normal_bits<value_type1>(v1, normal1), sizeof(normal1), normal_bits<value_type2>(v2, normal2), sizeof(normal2));
+      }
+      return d1._do_exact_compare(a, v1, sizeof(value_type1), b, v2, sizeof(value_type2));
+    }
+  };
+}  // namespace detail
+
+/*! A hash of a status code's domain id and value, for unordered containers
+performing exact rather than semantic comparison. Use with `exact_equal`.
+
+A typed code, and the same code erased, hash identically. Domains which set
+`status_code_domain::flag_trivially_erasable` are hashed without a virtual call,
+other domains may override `_do_exact_hash()` to hash what their value points to.
+*/
+struct exact_hash
+{
+  //! Enables heterogeneous lookup
+  using is_transparent = void;
+  //! Returns the hash of `code`.
+  template <class T, typename std::enable_if<std::is_base_of<status_code<void>, T>::value, bool>::type = true> size_t operator()(const T &code) const noexcept { return detail::exact_comparison::hash(code); }
+};
+
+/*! True if two status codes are of the same domain and have the same value,
+unlike `operator==` which is semantic. Empty codes equal only each other.
+*/
+struct exact_equal
+{
+  //! Enables heterogeneous lookup
+  using is_transparent = void;
+  //! True if `a` and `b` are exactly equal.
+  template <class T, class U, typename std::enable_if<std::is_base_of<status_code<void>, T>::value && std::is_base_of<status_code<void>, U>::value, bool>::type = true> bool operator()(const T &a, const U &b) const noexcept
+  {
+    return detail::exact_comparison::compare(a, b) == 0;
+  }
+};
+
+/*! A strict weak ordering of status codes by domain id and then value, for
+ordered containers. Empty codes order first. Consistent with `exact_equal`.
+*/
+struct exact_less
+{
+  //! Enables heterogeneous lookup
+  using is_transparent = void;
+  //! True if `a` orders before `b`.
+  template <class T, class U, typename std::enable_if<std::is_base_of<status_code<void>, T>::value && std::is_base_of<status_code<void>, U>::value, bool>::type = true> bool operator()(const T &a, const U &b) const noexcept
+  {
+    return detail::exact_comparison::compare(a, b) < 0;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,312 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_HISTOGRAM_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_HISTOGRAM_HPP
+
+#include "detail/per_thread_cache.hpp"
+#include "system_code.hpp"
+
+#include <algorithm>  // for sort
+#include <cstdint>    // for uint64_t
+#include <thread>     // for this_thread::get_id
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! Counts occurrences of status codes by exact domain id and erased value, from any number of threads.
+
+Each thread which records a code gets its own shard, a fixed size open
+addressed hash table written only by that thread. Recording a code therefore
+costs a hash and an uncontended add, and never blocks. Reading merges all the
+shards.
+
+Codes are counted by domain id rather than domain address, so codes from
+copies of a domain in different shared objects count together. The rollup
+by `errc` in `by_errc()` is computed when read, by asking each domain for the
+generic code of each distinct value recorded. Codes of domains without
+`status_code_domain::flag_trivially_erasable`, whose value may not outlive the
+code, such as those from `make_status_code_ptr()`, are therefore counted as
+their generic code equivalent.
+
+If a thread records more distinct codes than a shard has slots, the excess
+is counted by `dropped()`.
+*/
+class status_code_histogram
+{
+public:
+  //! The type of a domain id
+  using unique_id_type = status_code_domain::unique_id_type;
+  //! The type of an erased value
+  using value_type = system_code::value_type;
+
+  //! The count for one code
+  struct entry
+  {
+    //! The domain of the first occurrence recorded
+    const status_code_domain *domain;
+    //! The domain id
+    unique_id_type id;
+    //! The erased value
+    value_type value;
+    //! The number of occurrences
+    uint64_t count;
+  };
+
+private:
+  struct _slot
+  {
+    std::atomic<uint64_t> count{0};  // zero if unused, written last on first use
+    std::atomic<unique_id_type> id{0};
+    std::atomic<value_type> value{0};
+    std::atomic<const status_code_domain *> domain{nullptr};
+  };
+  struct _shard
+  {
+    std::thread::id owner;
+    _shard *next{nullptr};
+    std::atomic<uint64_t> dropped{0};
+    std::vector<_slot> slots;
+    explicit _shard(size_t n)
+        : owner(std::this_thread::get_id())
+        , slots(n)
+    {
+    }
+  };
+
+  // The shard each thread last used of each of the last few histograms it used
+  using _cache = detail::per_thread_cache<status_code_histogram, _shard>;
+
+  const uint64_t _instance;
+  const size_t _mask;
+  std::atomic<_shard *> _shards{nullptr};
+  std::atomic<uint64_t> _unsharded_dropped{0};
+
+  static size_t _hash(unique_id_type id, value_type value) noexcept
+  {
+    uint64_t h = id ^ (static_cast<uint64_t>(value) * 0x9e3779b97f4a7c15ULL);
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 32;
+    return static_cast<size_t>(h);
+  }
+  // Returns the calling thread's shard, creating it if needs be
+  _shard *_my_shard() noexcept
+  {
+    _shard *s = _cache::find(_instance);
+    if(s != nullptr)
+    {
+      return s;
+    }
+    const auto me = std::this_thread::get_id();
+    s = _shards.load(std::memory_order_acquire);
+    for(; s != nullptr; s = s->next)
+    {
+      if(s->owner == me)
+      {
+        break;
+      }
+    }
+    if(s == nullptr)
+    {
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+      try
+      {
+        s = new _shard(_mask + 1);
+      }
+      catch(...)
+      {
+        return nullptr;
+      }
+#else
+      s = new(std::nothrow) _shard(_mask + 1);
+      if(s == nullptr)
+      {
+        return nullptr;
+      }
+#endif
+      s->next = _shards.load(std::memory_order_relaxed);
+      while(!_shards.compare_exchange_weak(s->next, s, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+    _cache::set(_instance, s);
+    return s;
+  }
+
+public:
+  //! Constructs a histogram whose per thread shards have `slots_per_shard` slots, rounded up to a power of two.
+  explicit status_code_histogram(size_t slots_per_shard = 256)
+      : _instance(_cache::next_instance())
+      , _mask([](size_t n) {
+        size_t ret = 1;
+        while(ret < n)
+        {
+          ret <<= 1;
+        }
+        return ret - 1;
+      }(slots_per_shard))
+  {
+  }
+  status_code_histogram(const status_code_histogram &) = delete;
+  status_code_histogram(status_code_histogram &&) = delete;
+  status_code_histogram &operator=(const status_code_histogram &) = delete;
+  status_code_histogram &operator=(status_code_histogram &&) = delete;
+  ~status_code_histogram()
+  {
+    for(_shard *s = _shards.load(std::memory_order_acquire); s != nullptr;)
+    {
+      _shard *next = s->next;
+      delete s;
+      s = next;
+    }
+  }
+
+  //! Counts one occurrence of `code`. Empty codes are ignored.
+  void record(const system_code &code) noexcept
+  {
+    if(code.empty())
+    {
+      return;
+    }
+    _shard *s = _my_shard();
+    if(s == nullptr)
+    {
+      _unsharded_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    const status_code_domain *domain = &code.domain();
+    value_type value = code.value();
+    if((domain->flags() & status_code_domain::flag_trivially_erasable) == 0)
+    {
+      domain = &generic_code_domain;
+      value = static_cast<value_type>(code.to_generic_code().value());
+    }
+    const unique_id_type id = domain->id();
+    const size_t h = _hash(id, value);
+    for(size_t n = 0; n <= _mask; n++)
+    {
+      _slot &slot = s->slots[(h + n) & _mask];
+      const uint64_t count = slot.count.load(std::memory_order_relaxed);
+      if(count == 0)
+      {
+        slot.id.store(id, std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.domain.store(domain, std::memory_order_relaxed);
+        slot.count.store(1, std::memory_order_release);
+        return;
+      }
+      if(slot.id.load(std::memory_order_relaxed) == id && slot.value.load(std::memory_order_relaxed) == value)
+      {
+        // Only this thread writes this shard, so no read-modify-write is needed
+        slot.count.store(count + 1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    s->dropped.store(s->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  //! Returns the counts of all codes recorded, merged across threads, ordered by domain id then value.
+  std::vector<entry> snapshot() const
+  {
+    std::vector<entry> ret;
+    for(_shard *s = _shards.load(std::memory_order_acquire); s != nullptr; s = s->next)
+    {
+      for(const _slot &slot : s->slots)
+      {
+        const uint64_t count = slot.count.load(std::memory_order_acquire);
+        if(count != 0)
+        {
+          ret.push_back(entry{slot.domain.load(std::memory_order_relaxed), slot.id.load(std::memory_order_relaxed), slot.value.load(std::memory_order_relaxed), count});
+        }
+      }
+    }
+    std::sort(ret.begin(), ret.end(), [](const entry &a, const entry &b) { return (a.id != b.id) ? (a.id < b.id) : (a.value < b.value); });
+    size_t out = 0;
+    for(size_t n = 0; n < ret.size(); n++)
+    {
+      if(out > 0 && ret[out - 1].id == ret[n].id && ret[out - 1].value == ret[n].value)
+      {
+        ret[out - 1].count += ret[n].count;
+      }
+      else
+      {
+        ret[out++] = ret[n];
+      }
+    }
+    ret.resize(out);
+    return ret;
+  }
+
+  //! Returns the counts of all codes recorded rolled up by their generic code, ordered by `errc`.
+  std::vector<std::pair<errc, uint64_t>> by_errc() const
+  {
+    std::vector<std::pair<errc, uint64_t>> ret;
+    for(const entry &e : snapshot())
+    {
+      // Borrow the recorded bits as a code, then forget them without destroying anything
+      system_code borrowed;
+      const uintptr_t bits[2] = {reinterpret_cast<uintptr_t>(e.domain), static_cast<uintptr_t>(e.value)};
+      detail::bitcopy_relocate_in(borrowed, bits);
+      const errc ec = borrowed.to_generic_code().value();
+      new(&borrowed) system_code();
+      auto it = std::lower_bound(ret.begin(), ret.end(), ec, [](const std::pair<errc, uint64_t> &a, errc b) { return a.first < b; });
+      if(it != ret.end() && it->first == ec)
+      {
+        it->second += e.count;
+      }
+      else
+      {
+        ret.insert(it, std::make_pair(ec, e.count));
+      }
+    }
+    return ret;
+  }
+
+  //! Returns the total occurrences of all codes recorded.
+  uint64_t total() const
+  {
+    uint64_t ret = 0;
+    for(const entry &e : snapshot())
+    {
+      ret += e.count;
+    }
+    return ret;
+  }
+
+  //! Returns the number of occurrences not counted because a shard was full, or could not be allocated.
+  uint64_t dropped() const noexcept
+  {
+    uint64_t ret = _unsharded_dropped.load(std::memory_order_relaxed);
+    for(_shard *s = _shards.load(std::memory_order_acquire); s != nullptr; s = s->next)
+    {
+      ret += s->dropped.load(std::memory_order_relaxed);
+    }
+    return ret;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,519 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_JOURNAL_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_JOURNAL_HPP
+
+#include "detail/per_thread_cache.hpp"
+#include "system_code.hpp"
+
+#include <cstdint>  // for uint64_t
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+//! The header at the start of each segment file of a `status_code_journal`, in the native byte order.
+struct status_code_journal_header
+{
+  //! `"se2jrnl"` followed by a zero byte
+  char magic[8];
+  //! The version of the layout, currently 1
+  uint32_t version;
+  //! The size of each record, `sizeof(status_code_journal_record)`
+  uint32_t record_size;
+  //! The index of this segment within the journal
+  uint64_t segment;
+  //! The number of records this segment can hold
+  uint64_t capacity;
+  uint64_t reserved[4];
+};
+//! A record of a `status_code_journal`, in the native byte order.
+struct status_code_journal_record
+{
+  //! Nanoseconds since the system clock's epoch
+  uint64_t timestamp;
+  //! The thread which recorded this, its kernel thread id where available
+  uint64_t thread;
+  //! The unique id of the code's domain
+  uint64_t domain_id;
+  //! The code's value, sign extended
+  int64_t value;
+  //! The call site id given when recording
+  uint64_t site;
+  //! Nonzero once the record is complete, so records reserved but not written by a crashed process can be told apart
+  uint64_t committed;
+  uint64_t reserved[2];
+};
+static_assert(sizeof(status_code_journal_header) == 64, "status_code_journal_header is not 64 bytes");
+static_assert(sizeof(status_code_journal_record) == 64, "status_code_journal_record is not 64 bytes");
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>      // for snprintf
+#include <functional>  // for hash
+#include <mutex>
+#include <new>  // for nothrow
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! An append only journal of status codes, in memory mapped segment files.
+
+Each segment is preallocated and mapped when created. Each thread reserves a
+block of records at a time by adding to the segment's atomic tail, then writes
+records into its block in the mapping, so recording a code usually costs a few
+plain stores with no read-modify-writes, no system calls, and no messages
+rendered. Records reserved but never written, such as the rest of a thread's
+block when the segment is replaced, are left with `committed` zero. When a segment fills, the thread which finds it full creates the next
+segment, named `<prefix>.<index>` with the index six digits, after the highest
+existing one.
+
+As the segments are shared mappings, every completed record survives the
+process crashing. Records since the last `flush()` may be lost if the system
+crashes.
+
+Codes are recorded by domain id and value, so can be decoded in any process
+with the domains registered with `status_code_domain_registry`. Codes of domains
+without `status_code_domain::flag_trivially_erasable`, whose value may not
+outlive the code, are recorded as their generic code equivalent.
+*/
+class status_code_journal
+{
+  struct _segment
+  {
+    void *allocation{nullptr};
+    status_code_journal_record *records{nullptr};
+    size_t mapped_bytes{0};
+    uint64_t capacity{0};
+    // Written by every thread reserving records, so on a cache line of its own
+    alignas(64) std::atomic<uint64_t> tail{0};
+  };
+  // Each thread recording has one, written only by that thread
+  struct _writer
+  {
+    void *allocation{nullptr};
+    std::thread::id owner;
+    _writer *next{nullptr};
+    // The segment this thread is writing to, which is not unmapped while set here
+    alignas(64) std::atomic<_segment *> segment{nullptr};
+    // The records of `segment` reserved but not yet written
+    uint64_t reserved{0}, end{0};
+  };
+  static constexpr uint64_t _block_records = 16;
+
+  // The writer each thread last used of each of the last few journals it used
+  using _cache = detail::per_thread_cache<status_code_journal, _writer>;
+
+  uint64_t _instance{0};
+  std::string _prefix;
+  size_t _segment_bytes{0};
+  uint64_t _next_index{0};
+  std::atomic<_segment *> _current{nullptr};
+  std::mutex _rotate_lock;
+  bool _rotation_failed{false};
+  std::chrono::steady_clock::time_point _last_failure;
+  // Never freed until destruction, so that a writer may always touch the bookkeeping of a segment it has seen
+  std::vector<_segment *> _segments;
+  std::atomic<_writer *> _writers{nullptr};
+  std::atomic<uint64_t> _dropped{0};
+
+  // Segments and writers contain cache line aligned members, which operator new only guarantees to align from C++ 17
+  template <class T> static T *_new() noexcept
+  {
+    void *allocation = ::operator new(sizeof(T) + alignof(T), std::nothrow);
+    if(allocation == nullptr)
+    {
+      return nullptr;
+    }
+    void *p = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(allocation) + alignof(T) - 1) & ~static_cast<uintptr_t>(alignof(T) - 1));
+    auto *ret = new(p) T;
+    ret->allocation = allocation;
+    return ret;
+  }
+  template <class T> static void _delete(T *p) noexcept
+  {
+    void *allocation = p->allocation;
+    p->~T();
+    ::operator delete(allocation);
+  }
+  // Returns the calling thread's writer, creating it if needs be
+  _writer *_my_writer() noexcept
+  {
+    _writer *w = _cache::find(_instance);
+    if(w != nullptr)
+    {
+      return w;
+    }
+    const auto me = std::this_thread::get_id();
+    w = _writers.load(std::memory_order_acquire);
+    for(; w != nullptr; w = w->next)
+    {
+      if(w->owner == me)
+      {
+        break;
+      }
+    }
+    if(w == nullptr)
+    {
+      w = _new<_writer>();
+      if(w == nullptr)
+      {
+        return nullptr;
+      }
+      w->owner = me;
+      w->next = _writers.load(std::memory_order_relaxed);
+      while(!_writers.compare_exchange_weak(w->next, w, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+    _cache::set(_instance, w);
+    return w;
+  }
+  // True if any thread is writing to `s`. Must follow a sequentially consistent fence after replacing `_current`.
+  bool _in_use(const _segment *s) const noexcept
+  {
+    for(_writer *w = _writers.load(std::memory_order_acquire); w != nullptr; w = w->next)
+    {
+      if(w->segment.load(std::memory_order_acquire) == s)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static uint64_t _thread_id() noexcept
+  {
+    static thread_local uint64_t id = 0;
+    if(id == 0)
+    {
+#ifdef __linux__
+      id = static_cast<uint64_t>(::syscall(SYS_gettid));
+#else
+      id = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+#endif
+    }
+    return id;
+  }
+
+  // Creates, preallocates and maps the next segment file
+  generic_code _create_segment(_segment *&out) noexcept
+  {
+    char path[32];
+    int fd = -1;
+    std::string name;
+    for(;;)
+    {
+      snprintf(path, sizeof(path), ".%06llu", static_cast<unsigned long long>(_next_index));
+      name = _prefix + path;
+      fd = ::open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+      if(fd != -1 || errno != EEXIST)
+      {
+        break;
+      }
+      ++_next_index;
+    }
+    if(fd == -1)
+    {
+      return generic_code(static_cast<errc>(errno));
+    }
+#if defined(__linux__)
+    // Actually allocate the blocks, else writing to the mapping when the disk is full is SIGBUS
+    const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(_segment_bytes));
+#else
+    const int err = (::ftruncate(fd, static_cast<off_t>(_segment_bytes)) == -1) ? errno : 0;
+#endif
+    void *p = (err == 0) ? ::mmap(nullptr, _segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    const int maperr = errno;
+    ::close(fd);
+    if(p == MAP_FAILED)
+    {
+      ::unlink(name.c_str());
+      return generic_code(static_cast<errc>((err != 0) ? err : maperr));
+    }
+    auto *header = static_cast<status_code_journal_header *>(p);
+    const status_code_journal_header h = {{'s', 'e', '2', 'j', 'r', 'n', 'l', 0}, 1, sizeof(status_code_journal_record), _next_index, (_segment_bytes - sizeof(status_code_journal_header)) / sizeof(status_code_journal_record), {0, 0, 0, 0}};
+    memcpy(header, &h, sizeof(h));
+    out->records = reinterpret_cast<status_code_journal_record *>(header + 1);  // NOLINT
+    out->mapped_bytes = _segment_bytes;
+    out->capacity = h.capacity;
+    ++_next_index;
+    return generic_code(errc::success);
+  }
+
+  // Replaces the full segment `full` with a new one, returning false if that failed
+  bool _rotate(_segment *full) noexcept
+  {
+    std::lock_guard<std::mutex> g(_rotate_lock);
+    if(_current.load(std::memory_order_relaxed) != full)
+    {
+      return true;  // another thread did it
+    }
+    // Don't retry more than once a second, else every record would be system calls
+    const auto now = std::chrono::steady_clock::now();
+    if(_rotation_failed && now - _last_failure < std::chrono::seconds(1))
+    {
+      return false;
+    }
+    _segment *next = _new<_segment>();
+    bool ok = (next != nullptr);
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+    try
+    {
+      if(ok)
+      {
+        _segments.push_back(next);
+      }
+    }
+    catch(...)
+    {
+      _delete(next);
+      next = nullptr;
+      ok = false;
+    }
+#else
+    if(ok)
+    {
+      _segments.push_back(next);
+    }
+#endif
+    if(ok && _create_segment(next).failure())
+    {
+      _segments.pop_back();
+      _delete(next);
+      ok = false;
+    }
+    if(!ok)
+    {
+      _rotation_failed = true;
+      _last_failure = now;
+      return false;
+    }
+    _current.store(next, std::memory_order_release);
+    // Unmap the segments which are no longer written to. A writer sets its
+    // segment then checks `_current` is still that segment, with a fence between
+    // pairing with this one, so either it sees the new segment or this sees it
+    // writing to the old one. Segments still in use are unmapped by a later
+    // rotation, or by `close()`.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for(_segment *s : _segments)
+    {
+      if(s != next && s->records != nullptr && !_in_use(s))
+      {
+        _unmap(s);
+      }
+    }
+    return true;
+  }
+  static void _unmap(_segment *s) noexcept
+  {
+    void *p = reinterpret_cast<status_code_journal_header *>(s->records) - 1;  // NOLINT
+    // Start writing back now, as nothing can flush this segment once unmapped
+    ::msync(p, s->mapped_bytes, MS_ASYNC);
+    ::munmap(p, s->mapped_bytes);
+    s->records = nullptr;
+  }
+
+public:
+  //! Constructs a journal which is not open.
+  status_code_journal() = default;
+  status_code_journal(const status_code_journal &) = delete;
+  status_code_journal(status_code_journal &&) = delete;
+  status_code_journal &operator=(const status_code_journal &) = delete;
+  status_code_journal &operator=(status_code_journal &&) = delete;
+  ~status_code_journal() { close(); }
+
+  /*! Opens the journal, creating its first segment after any existing ones
+  named `<prefix>.<index>`, each of `segment_bytes` rounded up to whole pages.
+  Returns the failure if this fails.
+  */
+  generic_code open(const char *prefix, size_t segment_bytes = 64 * 1024 * 1024) noexcept
+  {
+    close();
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    _segment_bytes = (segment_bytes + page - 1) / page * page;
+    if(_segment_bytes < sizeof(status_code_journal_header) + sizeof(status_code_journal_record))
+    {
+      _segment_bytes = page;
+    }
+    _next_index = 0;
+    _rotation_failed = false;
+    _instance = _cache::next_instance();
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+    try
+    {
+      _prefix = prefix;
+      _segments.reserve(16);
+    }
+    catch(...)
+    {
+      return errc::not_enough_memory;
+    }
+#else
+    _prefix = prefix;
+#endif
+    _segment *first = _new<_segment>();
+    if(first == nullptr)
+    {
+      return errc::not_enough_memory;
+    }
+    _segments.push_back(first);
+    generic_code ret = _create_segment(first);
+    if(ret.success())
+    {
+      _current.store(first, std::memory_order_release);
+    }
+    return ret;
+  }
+
+  //! Flushes all records, closes the journal, and releases its resources. Must not race with `record()`.
+  void close() noexcept
+  {
+    flush();
+    _current.store(nullptr, std::memory_order_relaxed);
+    for(_segment *s : _segments)
+    {
+      if(s->records != nullptr)
+      {
+        _unmap(s);
+      }
+      _delete(s);
+    }
+    _segments.clear();
+    for(_writer *w = _writers.exchange(nullptr, std::memory_order_acquire); w != nullptr;)
+    {
+      _writer *next = w->next;
+      _delete(w);
+      w = next;
+    }
+    // Forget the writers cached by threads
+    _instance = 0;
+  }
+
+  //! True if the journal is open.
+  bool is_open() const noexcept { return _current.load(std::memory_order_relaxed) != nullptr; }
+
+  /*! Appends a record of `code` from call site `site`, returning false if it
+  could not be recorded. Empty codes are not recorded.
+  */
+  bool record(const system_code &code, uint64_t site = 0) noexcept
+  {
+    if(code.empty())
+    {
+      return false;
+    }
+    status_code_journal_record r;
+    r.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    r.thread = _thread_id();
+    if((code.domain().flags() & status_code_domain::flag_trivially_erasable) != 0)
+    {
+      r.domain_id = code.domain().id();
+      r.value = static_cast<int64_t>(code.value());
+    }
+    else
+    {
+      const generic_code g = code.to_generic_code();
+      r.domain_id = g.domain().id();
+      r.value = static_cast<int64_t>(g.value());
+    }
+    r.site = site;
+    _writer *w = nullptr;
+    for(;;)
+    {
+      _segment *s = _current.load(std::memory_order_acquire);
+      if(s == nullptr || (w == nullptr && (w = _my_writer()) == nullptr))
+      {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      if(w->segment.load(std::memory_order_relaxed) != s || w->reserved == w->end)
+      {
+        // Set the segment before checking it is still current, pairing with the fence in `_rotate()`
+        w->segment.store(s, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(_current.load(std::memory_order_relaxed) != s)
+        {
+          continue;  // it was replaced, and may be about to be unmapped
+        }
+        const uint64_t idx = s->tail.fetch_add(_block_records, std::memory_order_relaxed);
+        if(idx >= s->capacity)
+        {
+          w->segment.store(nullptr, std::memory_order_release);
+          w->reserved = w->end = 0;
+          if(!_rotate(s))
+          {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+          }
+          continue;
+        }
+        w->reserved = idx;
+        w->end = (s->capacity - idx < _block_records) ? s->capacity : idx + _block_records;
+      }
+      status_code_journal_record &dst = s->records[w->reserved++];
+      dst.timestamp = r.timestamp;
+      dst.thread = r.thread;
+      dst.domain_id = r.domain_id;
+      dst.value = r.value;
+      dst.site = r.site;
+      std::atomic_thread_fence(std::memory_order_release);
+      dst.committed = 1;
+      return true;
+    }
+  }
+
+  //! Writes the records completed so far to storage, so they survive the system crashing.
+  void flush() noexcept
+  {
+    std::lock_guard<std::mutex> g(_rotate_lock);
+    for(_segment *s : _segments)
+    {
+      if(s->records != nullptr)
+      {
+        ::msync(reinterpret_cast<status_code_journal_header *>(s->records) - 1, s->mapped_bytes, MS_SYNC);  // NOLINT
+      }
+    }
+  }
+
+  //! The number of codes which could not be recorded, because the journal was not open or a new segment could not be created.
+  uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,205 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_JSON_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_JSON_HPP
+
+#include "system_code.hpp"
+
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for memcpy
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // Writes JSON into a buffer, counting the bytes needed even once the buffer is full
+  class json_writer
+  {
+    char *_buffer;
+    size_t _bytes, _len{0};
+
+    static constexpr uint64_t _ones = 0x0101010101010101ULL;
+    static constexpr uint64_t _highs = 0x8080808080808080ULL;
+
+    // True if any byte of `w` is zero
+    static constexpr bool _has_zero(uint64_t w) noexcept { return ((w - _ones) & ~w & _highs) != 0; }
+    // True if any byte of `w` is less than 0x20, or is a quote or backslash
+    static constexpr bool _needs_escaping(uint64_t w) noexcept { return ((w - _ones * 0x20) & ~w & _highs) != 0 || _has_zero(w ^ (_ones * '"')) || _has_zero(w ^ (_ones * '\\')); }
+    void _escape_char(unsigned char c) noexcept
+    {
+      switch(c)
+      {
+      case '"':
+        write("\\\"", 2);
+        break;
+      case '\\':
+        write("\\\\", 2);
+        break;
+      case '\n':
+        write("\\n", 2);
+        break;
+      case '\r':
+        write("\\r", 2);
+        break;
+      case '\t':
+        write("\\t", 2);
+        break;
+      default:
+      {
+        const char u[6] = {'\\', 'u', '0', '0', "0123456789abcdef"[c >> 4], "0123456789abcdef"[c & 0xf]};
+        write(u, 6);
+      }
+      }
+    }
+
+  public:
+    json_writer(char *buffer, size_t bytes) noexcept
+        : _buffer(buffer)
+        , _bytes(bytes)
+    {
+    }
+    size_t length() const noexcept { return _len; }
+
+    void write(const char *s, size_t len) noexcept
+    {
+      if(len > 0 && _len + len <= _bytes)
+      {
+        memcpy(_buffer + _len, s, len);
+      }
+      _len += len;
+    }
+    template <size_t N> void write(const char (&s)[N]) noexcept { write(s, N - 1); }
+
+    // Writes `s` as a JSON string. Clean runs, which is all of most messages, are copied whole.
+    void write_string(const char *s, size_t len) noexcept
+    {
+      write("\"", 1);
+      size_t clean = 0, n = 0;
+      while(n < len)
+      {
+        if(len - n >= 8)
+        {
+          uint64_t w;
+          memcpy(&w, s + n, 8);
+          if(!_needs_escaping(w))
+          {
+            n += 8;
+            continue;
+          }
+        }
+        const auto c = static_cast<unsigned char>(s[n]);
+        if(c < 0x20 || c == '"' || c == '\\')
+        {
+          write(s + clean, n - clean);
+          _escape_char(c);
+          clean = n + 1;
+        }
+        ++n;
+      }
+      write(s + clean, len - clean);
+      write("\"", 1);
+    }
+    void write_int(int64_t v) noexcept
+    {
+      char digits[21], *p = digits + sizeof(digits);
+      uint64_t u = (v < 0) ? (0 - static_cast<uint64_t>(v)) : static_cast<uint64_t>(v);
+      do
+      {
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+      } while(u != 0);
+      if(v < 0)
+      {
+        *--p = '-';
+      }
+      write(p, digits + sizeof(digits) - p);
+    }
+    void write_hex_string(uint64_t v) noexcept
+    {
+      char hex[20] = {'"', '0', 'x'};
+      for(int n = 0; n < 16; n++)
+      {
+        hex[3 + n] = "0123456789abcdef"[(v >> (60 - n * 4)) & 0xf];
+      }
+      hex[19] = '"';
+      write(hex, 20);
+    }
+  };
+}  // namespace detail
+
+/*! Writes `code` as a JSON object into `buffer` of `bytes`, returning the
+length of the JSON. If that is more than `bytes`, the contents of `buffer` are
+unspecified. No null terminator is written. An empty code is written as `null`,
+and otherwise as, for example:
+
+    {"domain":"posix domain","id":"0xa59a56fe5f310933","value":2,"errc":2,"message":"No such file or directory"}
+
+The id is a string as JSON numbers are not exact beyond 53 bits. The value is
+`null` for domains without `status_code_domain::flag_trivially_erasable`, whose
+erased value is not the code's value.
+
+Strings are scanned eight bytes at a time for characters needing escaping, and
+copied whole when there are none, which is so for all the built-in domain names
+and static messages.
+*/
+inline size_t json_encode(char *buffer, size_t bytes, const system_code &code) noexcept
+{
+  detail::json_writer out(buffer, bytes);
+  if(code.empty())
+  {
+    out.write("null");
+    return out.length();
+  }
+  const status_code_domain &domain = code.domain();
+  out.write("{\"domain\":");
+  {
+    const auto name = domain.name();
+    out.write_string(name.data(), name.size());
+  }
+  out.write(",\"id\":");
+  out.write_hex_string(domain.id());
+  out.write(",\"value\":");
+  if((domain.flags() & status_code_domain::flag_trivially_erasable) != 0)
+  {
+    out.write_int(static_cast<int64_t>(code.value()));
+  }
+  else
+  {
+    out.write("null");
+  }
+  out.write(",\"errc\":");
+  out.write_int(static_cast<int>(code.to_generic_code().value()));
+  out.write(",\"message\":");
+  {
+    const auto msg = code.message();
+    out.write_string(msg.data(), msg.size());
+  }
+  out.write("}");
+  return out.length();
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,326 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_LOG_LIMITER_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_LOG_LIMITER_HPP
+
+#include "system_code.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>  // for uint64_t
+#include <cstdio>   // for fprintf
+#include <limits>
+#include <thread>   // for this_thread::yield
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! Deduplicates and rate limits the logging of status codes.
+
+Codes are keyed by domain id, value, and an optional call site string whose
+address identifies it. The first occurrence of a key is passed to the sink to
+be logged in full. Repeats within the following window are only counted, and
+the count is passed to the sink as a summary when the key next occurs after the
+window has ended, or when `flush()` is called.
+
+Deciding whether to log does not allocate. It is a hash and a few atomic
+operations on a fixed size open addressed table, allocated at construction,
+only waiting while another thread writes the key of the slot it needs. Slots
+whose window has ended without repeats are freed by `flush()`, so call it
+periodically. Keys which find no free slot nearby are logged every time, and
+counted by `untracked()`.
+
+Codes of domains without `status_code_domain::flag_trivially_erasable`, whose
+value may not outlive the code, are keyed by their generic code equivalent.
+*/
+class status_code_log_limiter
+{
+public:
+  //! The clock used for windows
+  using clock = std::chrono::steady_clock;
+  /*! The type of the function called to log. `repeats` is zero for an
+  occurrence to be logged in full, else the number of occurrences since the last
+  one logged.
+  */
+  using sink_type = void (*)(void *context, const status_code<void> &code, const char *site, uint64_t repeats);
+
+  //! A sink which writes to `stderr`.
+  static void stderr_sink(void * /*unused*/, const status_code<void> &code, const char *site, uint64_t repeats) noexcept
+  {
+    const auto name = code.domain().name();
+    const auto msg = code.message();
+    if(repeats == 0)
+    {
+      fprintf(stderr, "%s%s%s: %s\n", (site != nullptr) ? site : "", (site != nullptr) ? ": " : "", name.c_str(), msg.c_str());
+    }
+    else
+    {
+      fprintf(stderr, "%s%s%s: %s (%llu more)\n", (site != nullptr) ? site : "", (site != nullptr) ? ": " : "", name.c_str(), msg.c_str(), static_cast<unsigned long long>(repeats));
+    }
+  }
+
+private:
+  enum : uint64_t
+  {
+    _count_mask = (static_cast<uint64_t>(1) << 40) - 1,
+    _generation_one = static_cast<uint64_t>(1) << 40,
+    _unready = static_cast<uint64_t>(1) << 63
+  };
+  struct _slot
+  {
+    std::atomic<uint64_t> hash{0};  // zero if unused, claimed by compare and swap
+    // The repeats in the bottom bits, above them the generation of the key,
+    // incremented when the slot is freed, and `_unready` until the key is written
+    std::atomic<uint64_t> state{_unready};
+    std::atomic<const status_code_domain *> domain{nullptr};
+    std::atomic<intptr_t> value{0};
+    std::atomic<const char *> site{nullptr};
+    std::atomic<clock::rep> window_end{0};
+  };
+
+  const sink_type _sink;
+  void *const _context;
+  const clock::rep _window;
+  const size_t _mask;
+  std::vector<_slot> _slots;
+  std::atomic<uint64_t> _untracked{0};
+
+  enum : size_t
+  {
+    _max_probes = 16
+  };
+
+  static uint64_t _hash(status_code_domain::unique_id_type id, intptr_t value, const char *site) noexcept
+  {
+    uint64_t h = id ^ (static_cast<uint64_t>(value) * 0x9e3779b97f4a7c15ULL) ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(site)) * 0xc2b2ae3d27d4eb4fULL);
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 32;
+    return (h != 0) ? h : 1;
+  }
+  // Adds a repeat to `slot`, unless its key is no longer that read with `state`
+  static bool _add_repeat(_slot &slot, uint64_t state) noexcept
+  {
+    uint64_t expected = slot.state.load(std::memory_order_relaxed);
+    while((expected & ~_count_mask) == (state & ~_count_mask))
+    {
+      if((expected & _count_mask) == _count_mask || slot.state.compare_exchange_weak(expected, expected + 1, std::memory_order_relaxed))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+  // Takes the repeats of `slot`, unless its key is no longer that read with `state`
+  static bool _take_repeats(_slot &slot, uint64_t state, uint64_t &repeats) noexcept
+  {
+    uint64_t expected = slot.state.load(std::memory_order_relaxed);
+    while((expected & ~_count_mask) == (state & ~_count_mask))
+    {
+      if(slot.state.compare_exchange_weak(expected, expected & ~_count_mask, std::memory_order_relaxed))
+      {
+        repeats = expected & _count_mask;
+        return true;
+      }
+    }
+    return false;
+  }
+
+public:
+  /*! Constructs a limiter calling `sink` with `context`, suppressing repeats
+  for `window`, with `slots` slots rounded up to a power of two.
+  */
+  explicit status_code_log_limiter(sink_type sink = stderr_sink, void *context = nullptr, clock::duration window = std::chrono::seconds(10), size_t slots = 1024)
+      : _sink(sink)
+      , _context(context)
+      , _window(window.count())
+      , _mask([](size_t n) {
+        size_t ret = 1;
+        while(ret < n)
+        {
+          ret <<= 1;
+        }
+        return ret - 1;
+      }(slots))
+      , _slots(_mask + 1)
+  {
+  }
+  status_code_log_limiter(const status_code_log_limiter &) = delete;
+  status_code_log_limiter(status_code_log_limiter &&) = delete;
+  status_code_log_limiter &operator=(const status_code_log_limiter &) = delete;
+  status_code_log_limiter &operator=(status_code_log_limiter &&) = delete;
+  ~status_code_log_limiter() = default;
+
+  /*! Logs `code` from call site `site` if it has not occurred within the window,
+  returning true if the sink was called for it. Empty codes are ignored.
+  */
+  bool log(const system_code &code, const char *site = nullptr, clock::time_point now = clock::now()) noexcept
+  {
+    if(code.empty())
+    {
+      return false;
+    }
+    const status_code_domain *domain = &code.domain();
+    intptr_t value = code.value();
+    if((domain->flags() & status_code_domain::flag_trivially_erasable) == 0)
+    {
+      domain = &generic_code_domain;
+      value = static_cast<intptr_t>(code.to_generic_code().value());
+    }
+    const status_code_domain::unique_id_type id = domain->id();
+    const uint64_t h = _hash(id, value, site);
+    const clock::rep t = now.time_since_epoch().count();
+    const size_t probes = (_mask < _max_probes) ? _mask + 1 : static_cast<size_t>(_max_probes);
+    for(;;)
+    {
+      // Look for the key in all the slots it could be in, as slots before it may have been freed
+      size_t free_slot = probes;
+      bool restart = false;
+      for(size_t n = 0; n < probes && !restart;)
+      {
+        _slot &slot = _slots[(h + n) & _mask];
+        const uint64_t slot_hash = slot.hash.load(std::memory_order_acquire);
+        if(slot_hash == 0 && free_slot == probes)
+        {
+          free_slot = n;
+        }
+        if(slot_hash != h)
+        {
+          ++n;
+          continue;
+        }
+        const uint64_t state = slot.state.load(std::memory_order_acquire);
+        if((state & _unready) != 0)
+        {
+          // Another thread is writing or freeing the key, which is a few stores, so look again
+          std::this_thread::yield();
+          continue;
+        }
+        if(slot.domain.load(std::memory_order_relaxed)->id() != id || slot.value.load(std::memory_order_relaxed) != value || slot.site.load(std::memory_order_relaxed) != site)
+        {
+          ++n;
+          continue;
+        }
+        clock::rep window_end = slot.window_end.load(std::memory_order_relaxed);
+        if(t < window_end || !slot.window_end.compare_exchange_strong(window_end, t + _window, std::memory_order_relaxed))
+        {
+          if(_add_repeat(slot, state))
+          {
+            return false;
+          }
+          restart = true;  // the slot was freed
+          continue;
+        }
+        // This thread ended the window, so it logs the summary and starts the next window
+        uint64_t repeats = 0;
+        if(_take_repeats(slot, state, repeats) && repeats > 0)
+        {
+          _sink(_context, code, site, repeats);
+        }
+        _sink(_context, code, site, 0);
+        return true;
+      }
+      if(restart)
+      {
+        continue;
+      }
+      if(free_slot == probes)
+      {
+        break;
+      }
+      _slot &slot = _slots[(h + free_slot) & _mask];
+      uint64_t expected = 0;
+      if(!slot.hash.compare_exchange_strong(expected, h, std::memory_order_acq_rel, std::memory_order_relaxed))
+      {
+        continue;  // another thread claimed it, perhaps for this key
+      }
+      slot.domain.store(domain, std::memory_order_relaxed);
+      slot.value.store(value, std::memory_order_relaxed);
+      slot.site.store(site, std::memory_order_relaxed);
+      slot.window_end.store(t + _window, std::memory_order_relaxed);
+      slot.state.store(slot.state.load(std::memory_order_relaxed) & ~(_unready | _count_mask), std::memory_order_release);
+      _sink(_context, code, site, 0);
+      return true;
+    }
+    _untracked.fetch_add(1, std::memory_order_relaxed);
+    _sink(_context, code, site, 0);
+    return true;
+  }
+
+  /*! Passes to the sink a summary of the repeats of each key whose window ended
+  before `now`, and frees the slots of those keys. Call periodically, and with
+  `clock::time_point::max()` before destruction to summarise all outstanding
+  repeats.
+  */
+  void flush(clock::time_point now = clock::now()) noexcept
+  {
+    const clock::rep t = now.time_since_epoch().count();
+    for(_slot &slot : _slots)
+    {
+      const uint64_t state = slot.state.load(std::memory_order_acquire);
+      clock::rep window_end = slot.window_end.load(std::memory_order_relaxed);
+      if((state & _unready) != 0 || t < window_end)
+      {
+        continue;
+      }
+      if((state & _count_mask) != 0)
+      {
+        // The domain is trivially erasable, so the key is the code
+        const detail::erased_value_code code(slot.domain.load(std::memory_order_relaxed), slot.value.load(std::memory_order_relaxed));
+        const char *site = slot.site.load(std::memory_order_relaxed);
+        uint64_t repeats = 0;
+        if(!_take_repeats(slot, state, repeats))
+        {
+          continue;  // the key was replaced while read
+        }
+        if(repeats > 0)
+        {
+          _sink(_context, code, site, repeats);
+        }
+      }
+      // Stop log() ending the window while the slot is freed, then free it unless a repeat occurred meanwhile
+      if(!slot.window_end.compare_exchange_strong(window_end, (std::numeric_limits<clock::rep>::max)(), std::memory_order_relaxed))
+      {
+        continue;
+      }
+      uint64_t expected = state & ~_count_mask;
+      if(slot.state.compare_exchange_strong(expected, (expected + _generation_one) | _unready, std::memory_order_acq_rel, std::memory_order_relaxed))
+      {
+        slot.hash.store(0, std::memory_order_release);
+      }
+      else
+      {
+        slot.window_end.store(window_end, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  //! The number of occurrences logged without deduplication because no slot was free.
+  uint64_t untracked() const noexcept { return _untracked.load(std::memory_order_relaxed); }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,426 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_LOGGER_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_LOGGER_HPP
+
+#include "bitcopying_mpsc_queue.hpp"
+#include "detail/per_thread_cache.hpp"
+#include "system_code.hpp"
+
+#include <algorithm>  // for sort
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>  // for int64_t
+#include <cstdio>   // for fwrite, snprintf
+#include <mutex>
+#include <new>  // for nothrow
+#include <string>
+#include <thread>
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  //! A log line queued by `status_code_logger`, to be formatted later.
+  struct deferred_log_entry
+  {
+    enum : size_t
+    {
+      max_args = 4
+    };
+    const char *format{nullptr};
+    int64_t timestamp{0};  // nanoseconds since the system clock's epoch
+    int64_t args[max_args]{};
+    uint8_t nargs{0};
+    uint8_t unsigned_args{0};  // bit n set if args[n] is unsigned
+    system_code code;
+  };
+}  // namespace detail
+
+namespace traits
+{
+  template <> struct is_move_bitcopying<detail::deferred_log_entry>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace traits
+
+/*! Logs status codes with their messages formatted on a background thread.
+
+`log()` copies a format string pointer, a timestamp, up to four integer
+arguments and the code into a lock free queue owned by the calling thread, and
+returns. It does not allocate after a thread's first call, nor call into the
+code's domain. A background thread drains the queues, orders the entries
+drained by timestamp, and calls `message()` to format each into a line of the form:
+
+    2026-10-17T11:51:11.258694286Z <format>: <domain name>: <message>
+
+where each `{}` in the format is replaced by the next argument in decimal.
+Lines are passed to the sink in batches, from the background thread only.
+
+Codes passed by rvalue are relocated into the queue, so codes such as those
+from `make_status_code_ptr()` keep their payload until formatted, and are
+destroyed by the background thread afterwards. Codes passed by lvalue are bit
+copied if their domain has `status_code_domain::flag_trivially_erasable`, and
+otherwise cloned. `error` and typed codes convert to `system_code`.
+
+The format string is not copied, its address being its id, and so must
+outlive the logger. Use string literals. If the calling thread's queue is full,
+the entry is dropped and counted by `dropped()` rather than blocking.
+*/
+class status_code_logger
+{
+public:
+  //! The type of the function called with one or more whole lines of text, each ending with a newline.
+  using sink_type = void (*)(void *context, const char *lines, size_t length);
+
+  //! A sink which writes to `stderr`.
+  static void stderr_sink(void * /*unused*/, const char *lines, size_t length) noexcept
+  {
+    fwrite(lines, 1, length, stderr);
+    fflush(stderr);
+  }
+
+  //! The maximum number of integer arguments per line
+  static constexpr size_t max_args() noexcept { return detail::deferred_log_entry::max_args; }
+
+private:
+  using _entry = detail::deferred_log_entry;
+  enum : size_t
+  {
+    _shard_capacity = 1024
+  };
+  struct _shard
+  {
+    std::thread::id owner{std::this_thread::get_id()};
+    _shard *next{nullptr};
+    void *allocation{nullptr};
+    bitcopying_mpsc_queue<_entry, _shard_capacity> queue;
+  };
+
+  // The shard each thread last used of each of the last few loggers it used
+  using _cache = detail::per_thread_cache<status_code_logger, _shard>;
+
+  const sink_type _sink;
+  void *const _context;
+  const std::chrono::steady_clock::duration _poll_interval;
+  const uint64_t _instance;
+  std::atomic<_shard *> _shards{nullptr};
+  std::atomic<uint64_t> _dropped{0};
+
+  std::mutex _lock;
+  std::condition_variable _changed;
+  bool _stopping{false};
+  uint64_t _flush_requested{0}, _flushed{0};
+
+  // Used only by the background thread
+  std::vector<_entry> _batch;
+  std::vector<size_t> _order;
+  std::string _text;
+  std::thread _thread;
+
+  // Shards contain cache line aligned members, which operator new only guarantees to align from C++ 17
+  static _shard *_new_shard() noexcept
+  {
+    void *allocation = ::operator new(sizeof(_shard) + alignof(_shard), std::nothrow);
+    if(allocation == nullptr)
+    {
+      return nullptr;
+    }
+    void *p = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(allocation) + alignof(_shard) - 1) & ~static_cast<uintptr_t>(alignof(_shard) - 1));
+    auto *s = new(p) _shard;
+    s->allocation = allocation;
+    return s;
+  }
+  static void _delete_shard(_shard *s) noexcept
+  {
+    void *allocation = s->allocation;
+    s->~_shard();
+    ::operator delete(allocation);
+  }
+  // Returns the calling thread's shard, creating it if needs be
+  _shard *_my_shard() noexcept
+  {
+    _shard *s = _cache::find(_instance);
+    if(s != nullptr)
+    {
+      return s;
+    }
+    const auto me = std::this_thread::get_id();
+    s = _shards.load(std::memory_order_acquire);
+    for(; s != nullptr; s = s->next)
+    {
+      if(s->owner == me)
+      {
+        break;
+      }
+    }
+    if(s == nullptr)
+    {
+      s = _new_shard();
+      if(s == nullptr)
+      {
+        return nullptr;
+      }
+      s->next = _shards.load(std::memory_order_relaxed);
+      while(!_shards.compare_exchange_weak(s->next, s, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+    _cache::set(_instance, s);
+    return s;
+  }
+
+  template <class T, bool = std::is_enum<T>::value> struct _arg_type
+  {
+    using type = typename std::underlying_type<T>::type;
+  };
+  template <class T> struct _arg_type<T, false>
+  {
+    using type = T;
+  };
+  template <class T> static void _add_arg(_entry &e, T v) noexcept
+  {
+    using type = typename _arg_type<T>::type;
+    static_assert(std::is_integral<type>::value, "arguments must be integers or enumerations");
+    if(std::is_unsigned<type>::value)
+    {
+      e.unsigned_args |= static_cast<uint8_t>(1U << e.nargs);
+    }
+    e.args[e.nargs++] = static_cast<int64_t>(static_cast<type>(v));
+  }
+  template <class... Args> bool _push(const char *format, system_code &&code, Args... args) noexcept
+  {
+    static_assert(sizeof...(Args) <= _entry::max_args, "too many arguments");
+    if(code.empty())
+    {
+      return false;
+    }
+    _shard *s = _my_shard();
+    if(s == nullptr)
+    {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _entry e;
+    e.format = format;
+    e.timestamp = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    const int expand[] = {0, (_add_arg(e, args), 0)...};
+    (void) expand;
+    e.code = static_cast<system_code &&>(code);  // e.code is empty, so assignment cannot leak
+    if(!s->queue.try_push(static_cast<_entry &&>(e)))
+    {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
+  }
+
+  static void _append_timestamp(std::string &out, int64_t ns)
+  {
+    // Days to civil date after Howard Hinnant, as gmtime() is not reentrant everywhere
+    int64_t secs = ns / 1000000000, frac = ns % 1000000000;
+    if(frac < 0)
+    {
+      frac += 1000000000;
+      --secs;
+    }
+    int64_t days = secs / 86400, tod = secs % 86400;
+    if(tod < 0)
+    {
+      tod += 86400;
+      --days;
+    }
+    days += 719468;
+    const int64_t era = ((days >= 0) ? days : days - 146096) / 146097;
+    const int64_t doe = days - era * 146097;
+    const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int64_t mp = (5 * doy + 2) / 153;
+    const int64_t month = (mp < 10) ? mp + 3 : mp - 9;
+    const int64_t year = yoe + era * 400 + ((month <= 2) ? 1 : 0);
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%04lld-%02d-%02dT%02d:%02d:%02d.%09dZ ", static_cast<long long>(year), static_cast<int>(month), static_cast<int>(doy - (153 * mp + 2) / 5 + 1), static_cast<int>(tod / 3600), static_cast<int>(tod / 60 % 60), static_cast<int>(tod % 60), static_cast<int>(frac));
+    out.append(buffer);
+  }
+  static void _append_line(std::string &out, const _entry &e)
+  {
+    _append_timestamp(out, e.timestamp);
+    size_t arg = 0;
+    for(const char *f = e.format; *f != 0; ++f)
+    {
+      if(f[0] == '{' && f[1] == '}' && arg < e.nargs)
+      {
+        char buffer[24];
+        if((e.unsigned_args >> arg) & 1)
+        {
+          snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(e.args[arg]));
+        }
+        else
+        {
+          snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(e.args[arg]));
+        }
+        out.append(buffer);
+        ++arg;
+        ++f;
+        continue;
+      }
+      out.push_back(*f);
+    }
+    const auto name = e.code.domain().name();
+    const auto msg = e.code.message();
+    out.append(": ");
+    out.append(name.c_str(), name.size());
+    out.append(": ");
+    out.append(msg.c_str(), msg.size());
+    out.push_back('\n');
+  }
+  // Formats and writes everything queued, returning the number of lines written
+  size_t _drain()
+  {
+    for(_shard *s = _shards.load(std::memory_order_acquire); s != nullptr; s = s->next)
+    {
+      const size_t at = _batch.size();
+      _batch.resize(at + _shard_capacity);
+      _batch.resize(at + s->queue.try_pop_bulk(_batch.data() + at, _shard_capacity));
+    }
+    const size_t count = _batch.size();
+    if(count == 0)
+    {
+      return 0;
+    }
+    // Each thread's entries are already in order, so this merely interleaves threads
+    _order.resize(count);
+    for(size_t n = 0; n < count; n++)
+    {
+      _order[n] = n;
+    }
+    std::sort(_order.begin(), _order.end(), [this](size_t a, size_t b) { return (_batch[a].timestamp != _batch[b].timestamp) ? (_batch[a].timestamp < _batch[b].timestamp) : (a < b); });
+    _text.clear();
+    for(size_t n : _order)
+    {
+      _append_line(_text, _batch[n]);
+    }
+    _sink(_context, _text.data(), _text.size());
+    _batch.clear();
+    return count;
+  }
+  void _run()
+  {
+    std::unique_lock<std::mutex> g(_lock);
+    for(;;)
+    {
+      const uint64_t requested = _flush_requested;
+      const bool stopping = _stopping;
+      g.unlock();
+      while(_drain() > 0)
+      {
+      }
+      g.lock();
+      _flushed = requested;
+      _changed.notify_all();
+      if(stopping)
+      {
+        return;
+      }
+      _changed.wait_for(g, _poll_interval, [&] { return _stopping || _flush_requested != requested; });
+    }
+  }
+
+public:
+  /*! Constructs a logger calling `sink` with `context`, launching the background
+  thread, which checks for entries every `poll_interval`.
+  */
+  explicit status_code_logger(sink_type sink = stderr_sink, void *context = nullptr, std::chrono::steady_clock::duration poll_interval = std::chrono::milliseconds(10))
+      : _sink(sink)
+      , _context(context)
+      , _poll_interval(poll_interval)
+      , _instance(_cache::next_instance())
+  {
+    _thread = std::thread([this] { _run(); });
+  }
+  status_code_logger(const status_code_logger &) = delete;
+  status_code_logger(status_code_logger &&) = delete;
+  status_code_logger &operator=(const status_code_logger &) = delete;
+  status_code_logger &operator=(status_code_logger &&) = delete;
+  //! Writes everything queued and stops the background thread. There must be no concurrent calls to `log()`.
+  ~status_code_logger()
+  {
+    {
+      std::lock_guard<std::mutex> g(_lock);
+      _stopping = true;
+    }
+    _changed.notify_all();
+    _thread.join();
+    for(_shard *s = _shards.load(std::memory_order_acquire); s != nullptr;)
+    {
+      _shard *next = s->next;
+      _delete_shard(s);
+      s = next;
+    }
+  }
+
+  /*! Queues `code` to be logged with `format` and integer or enumeration
+  `args`, relocating it into the queue. Returns false if the code was empty,
+  or dropped as the queue was full.
+  */
+  template <class... Args> bool log(const char *format, system_code &&code, Args... args) noexcept { return _push(format, static_cast<system_code &&>(code), args...); }
+  /*! Queues a copy of `code` to be logged with `format` and integer or
+  enumeration `args`. May throw if cloning the code throws.
+  */
+  template <class... Args> bool log(const char *format, const system_code &code, Args... args)
+  {
+    if(code.empty())
+    {
+      return false;
+    }
+    if((code.domain().flags() & status_code_domain::flag_trivially_erasable) != 0)
+    {
+      // The value is the whole of the code, so the bits are a copy
+      system_code copy;
+      detail::bitcopy_relocate_in(copy, &code);
+      return _push(format, static_cast<system_code &&>(copy), args...);
+    }
+    return _push(format, code.clone(), args...);
+  }
+
+  //! Returns after everything queued before the call has been passed to the sink.
+  void flush()
+  {
+    std::unique_lock<std::mutex> g(_lock);
+    const uint64_t ticket = ++_flush_requested;
+    _changed.notify_all();
+    _changed.wait(g, [&] { return _flushed >= ticket; });
+  }
+
+  //! The number of entries dropped because a queue was full, or could not be allocated.
+  uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,191 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_PROMETHEUS_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_PROMETHEUS_HPP
+
+#include "status_code_histogram.hpp"
+
+#include <cerrno>
+#include <cstdio>  // for fopen
+#include <string>
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! Renders the counts of a `status_code_histogram` in the Prometheus text
+exposition format, as a counter with one series per code:
+
+    system_error2_status_codes_total{domain="posix domain",errc="2",value="2"} 15
+
+The `errc` label is the generic code of the code, so series can be summed by
+it. Each series' text is kept between renders, built when the code is first
+seen, and only its count is rewritten when that changes. Rendering is thus
+mostly copying, even for thousands of series.
+
+The histogram may be recorded into concurrently, but the exporter may only be
+used by one thread at a time.
+*/
+class status_code_prometheus_exporter
+{
+  struct _series
+  {
+    status_code_domain::unique_id_type id;
+    status_code_histogram::value_type value;
+    uint64_t count;
+    size_t count_offset;  // where the count begins in `line`
+    std::string line;
+  };
+
+  const status_code_histogram &_histogram;
+  std::string _header;
+  const std::string _name;
+  std::vector<_series> _cache;
+
+  static void _append_label_value(std::string &out, const char *s, size_t len)
+  {
+    for(size_t n = 0; n < len; n++)
+    {
+      switch(s[n])
+      {
+      case '\\':
+        out.append("\\\\");
+        break;
+      case '"':
+        out.append("\\\"");
+        break;
+      case '\n':
+        out.append("\\n");
+        break;
+      default:
+        out.push_back(s[n]);
+      }
+    }
+  }
+
+  // Brings the cached series up to date with the histogram
+  void _update()
+  {
+    for(const status_code_histogram::entry &e : _histogram.snapshot())
+    {
+      auto it = std::lower_bound(_cache.begin(), _cache.end(), e, [](const _series &a, const status_code_histogram::entry &b) { return (a.id != b.id) ? (a.id < b.id) : (a.value < b.value); });
+      if(it == _cache.end() || it->id != e.id || it->value != e.value)
+      {
+        _series s{e.id, e.value, 0, 0, _name};
+        // The histogram records codes of domains which are not trivially erasable as their generic code, so the value is the whole of the code
+        const detail::erased_value_code code(e.domain, e.value);
+        const auto name = code.domain().name();
+        s.line.append("{domain=\"");
+        _append_label_value(s.line, name.data(), name.size());
+        s.line.append("\",errc=\"").append(std::to_string(static_cast<int>(code.to_generic_code().value())));
+        s.line.append("\",value=\"").append(std::to_string(e.value)).append("\"} ");
+        s.count_offset = s.line.size();
+        it = _cache.insert(it, static_cast<_series &&>(s));
+      }
+      if(it->count != e.count || it->line.size() == it->count_offset)
+      {
+        it->count = e.count;
+        it->line.resize(it->count_offset);
+        it->line.append(std::to_string(e.count)).push_back('\n');
+      }
+    }
+  }
+
+public:
+  //! Constructs an exporter of `histogram` as the counter named `metric_name`.
+  explicit status_code_prometheus_exporter(const status_code_histogram &histogram, std::string metric_name = "system_error2_status_codes_total")
+      : _histogram(histogram)
+      , _name(static_cast<std::string &&>(metric_name))
+  {
+    _header.append("# HELP ").append(_name).append(" Occurrences of status codes by domain and value.\n");
+    _header.append("# TYPE ").append(_name).append(" counter\n");
+  }
+
+  /*! Renders all series into `buffer` of `bytes`, returning the length of the
+  text, which is written only if it fits. No null terminator is written.
+  */
+  size_t render(char *buffer, size_t bytes)
+  {
+    _update();
+    size_t len = _header.size();
+    for(const _series &s : _cache)
+    {
+      len += s.line.size();
+    }
+    if(len <= bytes)
+    {
+      char *p = buffer;
+      memcpy(p, _header.data(), _header.size());
+      p += _header.size();
+      for(const _series &s : _cache)
+      {
+        memcpy(p, s.line.data(), s.line.size());
+        p += s.line.size();
+      }
+    }
+    return len;
+  }
+
+  /*! Renders all series into the file at `path`, for the textfile collector of
+  the Prometheus node exporter. The file is written under a temporary name then
+  renamed, so the collector never sees a partial file. Returns the failure if
+  this fails.
+  */
+  generic_code write_textfile(const char *path)
+  {
+    _update();
+    const std::string temp = std::string(path) + ".tmp";
+    FILE *f = fopen(temp.c_str(), "wb");  // NOLINT
+    if(f == nullptr)
+    {
+      return generic_code(static_cast<errc>(errno));
+    }
+    bool ok = fwrite(_header.data(), 1, _header.size(), f) == _header.size();
+    for(size_t n = 0; ok && n < _cache.size(); n++)
+    {
+      ok = fwrite(_cache[n].line.data(), 1, _cache[n].line.size(), f) == _cache[n].line.size();
+    }
+    int err = ok ? 0 : errno;
+    if(fclose(f) != 0 && ok)
+    {
+      ok = false;
+      err = errno;
+    }
+    if(ok && rename(temp.c_str(), path) != 0)
+    {
+      ok = false;
+      err = errno;
+    }
+    if(!ok)
+    {
+      remove(temp.c_str());
+      return generic_code(static_cast<errc>((err != 0) ? err : EIO));
+    }
+    return generic_code(errc::success);
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
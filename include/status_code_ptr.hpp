@@ -26,6 +26,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define SYSTEM_ERROR2_STATUS_CODE_PTR_HPP
 
 #include "status_code.hpp"
+#include "status_code_exact.hpp"
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
@@ -110,6 +111,19 @@ namespace detail
       auto &c = static_cast<_mycode &>(code);  // NOLINT
       delete c.value();                        // NOLINT
     }
+    virtual size_t _do_exact_hash(const status_code<void> &code, const void * /*unused*/, size_t /*unused*/) const noexcept override  // NOLINT
+    {
+      assert(code.domain() == *this);
+      const auto &c = static_cast<const _mycode &>(code);  // NOLINT
+      return exact_comparison::hash(*c.value());
+    }
+    virtual int _do_exact_compare(const status_code<void> &code1, const void * /*unused*/, size_t /*unused*/, const status_code<void> &code2, const void * /*unused*/, size_t /*unused*/) const noexcept override  // NOLINT
+    {
+      assert(code1.domain() == *this && code2.domain() == *this);
+      const auto &c1 = static_cast<const _mycode &>(code1);  // NOLINT
+      const auto &c2 = static_cast<const _mycode &>(code2);  // NOLINT
+      return exact_comparison::compare(*c1.value(), *c2.value());
+    }
   };
 #if __cplusplus >= 201402L || defined(_MSC_VER)
   template <class StatusCode> constexpr indirecting_domain<StatusCode> _indirecting_domain{};
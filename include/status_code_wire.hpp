@@ -0,0 +1,251 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_WIRE_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_WIRE_HPP
+
+#include "status_code_domain_registry.hpp"
+#include "system_code.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! The most bytes `wire_encode()` writes for a code whose domain has no payload
+extension. Codes with small values, such as errno values, take ten bytes, and
+those with 32 bit values, such as NT and COM failures, at most thirteen.
+*/
+constexpr size_t wire_encoded_max_size = 9 + sizeof(intptr_t);
+
+namespace detail
+{
+  /* The wire encoding of a status code is:
+
+  - Eight bytes of the domain's unique id, little endian. Zero for an empty code.
+  - One header byte. Bits 0-3 are the number of value bytes to follow, bit 4 is
+  set if a payload extension follows the value, bits 5-7 are zero.
+  - The value, little endian, in the fewest bytes which sign extend back to it.
+  Zero takes no bytes, and -1 one byte.
+  - If there is a payload extension, two bytes of its length, little endian,
+  followed by that many bytes, all defined by the domain.
+  */
+  struct wire_codec
+  {
+    enum : unsigned char
+    {
+      has_extension = 1U << 4
+    };
+
+    // Sign extends the lowest `bytes` bytes of `value`
+    static int64_t sign_extend(uint64_t value, unsigned bytes) noexcept
+    {
+      if(bytes == 0 || bytes >= 8)
+      {
+        return (bytes == 0) ? 0 : static_cast<int64_t>(value);
+      }
+      const uint64_t sign = static_cast<uint64_t>(1) << (bytes * 8 - 1);
+      return static_cast<int64_t>((value & ((sign << 1) - 1)) ^ sign) - static_cast<int64_t>(sign);
+    }
+
+    static size_t encode(void *buffer, size_t bytes, const system_code &code) noexcept
+    {
+      auto *out = static_cast<unsigned char *>(buffer);
+      const bool extended = !code.empty() && (code.domain().flags() & status_code_domain::flag_has_wire_extension) != 0;
+      if(!code.empty() && !extended && !value_is_code(code.domain()))
+      {
+        // The value refers to state in this process, such as the pointer of a status_code_ptr
+        return 0;
+      }
+      const uint64_t id = code.empty() ? 0 : code.domain().id();
+      const uint64_t value = code.empty() ? 0 : static_cast<uint64_t>(static_cast<int64_t>(code.value()));
+      unsigned char value_bytes = 0;
+      while(sign_extend(value, value_bytes) != static_cast<int64_t>(value))
+      {
+        ++value_bytes;
+      }
+      size_t len = 9 + value_bytes, extension = 0;
+      if(extended)
+      {
+        // Ask the domain to write its extension straight into the buffer, if there is room
+        const size_t offset = len + 2;
+        extension = code.domain()._do_wire_extension(code, (bytes > offset) ? out + offset : nullptr, (bytes > offset) ? bytes - offset : 0);
+        if(extension > 0xffff)
+        {
+          return 0;
+        }
+        len = offset + extension;
+      }
+      if(len > bytes)
+      {
+        return len;
+      }
+      for(int n = 0; n < 8; n++)
+      {
+        out[n] = static_cast<unsigned char>(id >> (n * 8));
+      }
+      out[8] = static_cast<unsigned char>(value_bytes | (extended ? has_extension : 0));
+      for(int n = 0; n < value_bytes; n++)
+      {
+        out[9 + n] = static_cast<unsigned char>(value >> (n * 8));
+      }
+      if(extended)
+      {
+        out[9 + value_bytes] = static_cast<unsigned char>(extension);
+        out[10 + value_bytes] = static_cast<unsigned char>(extension >> 8);
+      }
+      return len;
+    }
+
+    static generic_code decode(system_code &out, size_t &consumed, const void *buffer, size_t bytes) noexcept
+    {
+      const auto *in = static_cast<const unsigned char *>(buffer);
+      out = system_code();
+      consumed = 0;
+      if(bytes < 9)
+      {
+        return errc::bad_message;
+      }
+      uint64_t id = 0, value = 0;
+      for(int n = 0; n < 8; n++)
+      {
+        id |= static_cast<uint64_t>(in[n]) << (n * 8);
+      }
+      const unsigned value_bytes = in[8] & 0xfU;
+      const bool extended = (in[8] & has_extension) != 0;
+      if(value_bytes > 8 || (in[8] & ~(0xfU | has_extension)) != 0)
+      {
+        return errc::bad_message;
+      }
+      size_t len = 9 + value_bytes, extension = 0;
+      if(len + (extended ? 2 : 0) > bytes)
+      {
+        return errc::bad_message;
+      }
+      for(unsigned n = 0; n < value_bytes; n++)
+      {
+        value |= static_cast<uint64_t>(in[9 + n]) << (n * 8);
+      }
+      if(extended)
+      {
+        extension = static_cast<size_t>(in[len]) | (static_cast<size_t>(in[len + 1]) << 8);
+        len += 2;
+        if(len + extension > bytes)
+        {
+          return errc::bad_message;
+        }
+      }
+      const int64_t svalue = sign_extend(value, value_bytes);
+      if(svalue < static_cast<int64_t>(INTPTR_MIN) || svalue > static_cast<int64_t>(INTPTR_MAX))
+      {
+        return errc::value_too_large;
+      }
+      if(id == 0)
+      {
+        if(value != 0 || extended)
+        {
+          return errc::bad_message;
+        }
+        consumed = len;
+        return errc::success;
+      }
+      if(!rebuild(out, id, static_cast<intptr_t>(svalue), extended ? in + len : nullptr, extension))
+      {
+        return errc::not_supported;
+      }
+      consumed = len + extension;
+      return errc::success;
+    }
+
+    // True if the value of a code of `domain` is the whole of the code, and so means the same in any process
+    static bool value_is_code(const status_code_domain &domain) noexcept
+    {
+      const status_code_domain::flags_type flags = domain.flags();
+      return (flags & status_code_domain::flag_trivially_erasable) != 0 && (flags & status_code_domain::flag_has_wire_extension) == 0;
+    }
+
+    // Rebuilds into the empty `out` the code of the registered domain `id`, returning false if that is not possible
+    static bool rebuild(system_code &out, status_code_domain::unique_id_type id, intptr_t value, const void *extension, size_t extension_bytes) noexcept
+    {
+      return rebuild(out, status_code_domain_registry::find(id), value, extension, extension_bytes);
+    }
+    static bool rebuild(system_code &out, const status_code_domain *domain, intptr_t value, const void *extension, size_t extension_bytes) noexcept
+    {
+      if(domain == nullptr)
+      {
+        return false;
+      }
+      if(extension == nullptr && (domain->flags() & status_code_domain::flag_trivially_erasable) != 0)
+      {
+        // The value bits alone are the code, so rebuild it directly
+        struct
+        {
+          const status_code_domain *domain;
+          intptr_t value;
+        } bits = {domain, value};
+        static_assert(sizeof(bits) == sizeof(system_code), "system_code is not a domain pointer followed by its value");
+        bitcopy_relocate_in(out, &bits);
+        return true;
+      }
+      if(!domain->_do_wire_decode(out, sizeof(out), value, extension, extension_bytes))
+      {
+        out = system_code();
+        return false;
+      }
+      return true;
+    }
+  };
+}  // namespace detail
+
+/*! Writes the compact binary wire encoding of `code` into `buffer` of `bytes`,
+returning the bytes written. If `bytes` is too small, writes nothing and returns
+the bytes needed. Returns zero if the code cannot be encoded, which are codes of
+domains which are neither trivially erasable nor have a payload extension, such
+as those from `make_status_code_ptr()`.
+
+The domain id and value are written as integers, so the encoding is independent
+of the platform. Domains setting `status_code_domain::flag_has_wire_extension`
+append a payload extension produced by their `_do_wire_extension()`.
+*/
+inline size_t wire_encode(void *buffer, size_t bytes, const system_code &code) noexcept
+{
+  return detail::wire_codec::encode(buffer, bytes, code);
+}
+
+/*! Rebuilds into `out` the code whose wire encoding begins `buffer` of `bytes`,
+setting `consumed` to the length of that encoding. No memory is allocated.
+
+The domain is found by its unique id using `status_code_domain_registry`. Codes
+of domains setting `status_code_domain::flag_trivially_erasable` are rebuilt
+from their value directly, other domains or any with a payload extension must
+implement `_do_wire_decode()`. Returns `errc::bad_message` if the encoding is
+malformed or truncated, `errc::value_too_large` if the value does not fit into
+a `system_code`, and `errc::not_supported` if the domain is not registered or
+cannot rebuild the code.
+*/
+inline generic_code wire_decode(system_code &out, size_t &consumed, const void *buffer, size_t bytes) noexcept
+{
+  return detail::wire_codec::decode(out, consumed, buffer, bytes);
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
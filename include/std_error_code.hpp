@@ -101,7 +101,7 @@ public:
 
   //! Default constructor
   explicit _std_error_code_domain(const _error_category_type &category) noexcept
-      : _base(0x223a160d20de97b4 ^ reinterpret_cast<_base::unique_id_type>(&category))
+      : _base(0x223a160d20de97b4 ^ reinterpret_cast<_base::unique_id_type>(&category), _base::flag_trivially_erasable)
       , _name("std_error_code_domain(")
   {
     _name.append(category.name());
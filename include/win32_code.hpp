@@ -25,17 +25,16 @@ http://www.boost.org/LICENSE_1_0.txt)
 #ifndef SYSTEM_ERROR2_WIN32_CODE_HPP
 #define SYSTEM_ERROR2_WIN32_CODE_HPP
 
-#if !defined(_WIN32) && !defined(STANDARDESE_IS_IN_THE_HOUSE)
-#error This file should only be included on Windows
-#endif
-
 #include "quick_status_code_from_enum.hpp"
 
+#include "detail/win32_code_tables.hpp"
+
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
 //! \exclude
 namespace win32
 {
+#ifdef _WIN32
   // A Win32 DWORD
   using DWORD = unsigned long;
   // Used to retrieve the current Win32 error code
@@ -54,13 +53,47 @@ namespace win32
 #pragma comment(linker, "/alternatename:?FormatMessageW@win32@system_error2@@YGKKPBXKKPA_WKPAX@Z=__imp__FormatMessageW@28")
 #pragma comment(linker, "/alternatename:?WideCharToMultiByte@win32@system_error2@@YGHIKPB_WHPADHPBDPAH@Z=__imp__WideCharToMultiByte@32")
 #endif
+#else
+  // A Win32 DWORD, as found in codes reported by Windows machines
+  using DWORD = uint32_t;
+#endif
 }  // namespace win32
 
+namespace detail
+{
+  /* On platforms without FormatMessage(), returns the embedded message `msg`, or
+  if there is none the code formatted as `prefix` followed by its hexadecimal value.
+  */
+  inline status_code_domain::string_ref win32_code_embedded_message(const char *msg, const char *prefix, uint32_t c) noexcept
+  {
+    if(msg != nullptr)
+    {
+      return status_code_domain::string_ref(msg);
+    }
+    const size_t prefixlen = cstrlen(prefix);
+    auto *p = static_cast<char *>(malloc(prefixlen + 11));  // NOLINT
+    if(p == nullptr)
+    {
+      return status_code_domain::string_ref("failed to get message from system");
+    }
+    memcpy(p, prefix, prefixlen);
+    char *end = p + prefixlen;
+    *end++ = '0';
+    *end++ = 'x';
+    for(int shift = 28; shift >= 0; shift -= 4)
+    {
+      *end++ = "0123456789abcdef"[(c >> shift) & 0xf];  // NOLINT
+    }
+    *end = 0;  // NOLINT
+    return status_code_domain::atomic_refcounted_string_ref(p, end - p);
+  }
+}  // namespace detail
+
 class _win32_code_domain;
 class _com_code_domain;
-//! (Windows only) A Win32 error code, those returned by `GetLastError()`.
+//! A Win32 error code, those returned by `GetLastError()`.
 using win32_code = status_code<_win32_code_domain>;
-//! (Windows only) A specialisation of `status_error` for the Win32 error code domain.
+//! A specialisation of `status_error` for the Win32 error code domain.
 using win32_error = status_error<_win32_code_domain>;
 
 namespace mixins
@@ -69,12 +102,18 @@ namespace mixins
   {
     using Base::Base;
 
-    //! Returns a `win32_code` for the current value of `GetLastError()`.
+#ifdef _WIN32
+    //! (Windows only) Returns a `win32_code` for the current value of `GetLastError()`.
     static inline win32_code current() noexcept;
+#endif
   };
 }  // namespace mixins
 
-/*! (Windows only) The implementation of the domain for Win32 error codes, those returned by `GetLastError()`.
+/*! The implementation of the domain for Win32 error codes, those returned by `GetLastError()`.
+
+On platforms other than Windows, this domain decodes Win32 error codes reported
+by Windows machines. Mapping to generic codes and equivalence work as on Windows,
+messages come from a compact embedded table of the commonly seen codes.
  */
 class _win32_code_domain : public status_code_domain
 {
@@ -84,17 +123,18 @@ class _win32_code_domain : public status_code_domain
   using _base = status_code_domain;
   static int _win32_code_to_errno(win32::DWORD c)
   {
-    switch(c)
+    if(c == 0)
     {
-    case 0:
-      return 0;
-#include "detail/win32_code_to_generic_code.ipp"
+      return 0;  // success
     }
-    return -1;
+    return detail::win32_code_to_errno(static_cast<uint32_t>(c));
   }
   //! Construct from a Win32 error code
   static _base::string_ref _make_string_ref(win32::DWORD c) noexcept
   {
+#ifndef _WIN32
+    return detail::win32_code_embedded_message(detail::win32_code_message(c), "unknown win32 code ", c);
+#else
     wchar_t buffer[32768];
     win32::DWORD wlen = win32::FormatMessageW(0x00001000 /*FORMAT_MESSAGE_FROM_SYSTEM*/ | 0x00000200 /*FORMAT_MESSAGE_IGNORE_INSERTS*/, nullptr, c, 0, buffer, 32768, nullptr);
     size_t allocation = wlen + (wlen >> 1);
@@ -129,6 +169,7 @@ class _win32_code_domain : public status_code_domain
       }
       return _base::string_ref("failed to get message from system");
     }
+#endif
   }
 
 public:
@@ -139,7 +180,7 @@ public:
 public:
   //! Default constructor
   constexpr explicit _win32_code_domain(typename _base::unique_id_type id = 0x8cd18ee72d680f1b) noexcept
-      : _base(id)
+      : _base(id, _base::flag_trivially_erasable)
   {
   }
   _win32_code_domain(const _win32_code_domain &) = default;
@@ -198,17 +239,20 @@ protected:
   }
 #endif
 };
-//! (Windows only) A constexpr source variable for the win32 code domain, which is that of `GetLastError()` (Windows). Returned by `_win32_code_domain::get()`.
+//! A constexpr source variable for the win32 code domain, which is that of `GetLastError()` (Windows). Returned by `_win32_code_domain::get()`.
 constexpr _win32_code_domain win32_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(win32_code_domain);
 inline constexpr const _win32_code_domain &_win32_code_domain::get()
 {
   return win32_code_domain;
 }
 
+#ifdef _WIN32
 namespace mixins
 {
   template <class Base> inline win32_code mixin<Base, _win32_code_domain>::current() noexcept { return win32_code(win32::GetLastError()); }
 }  // namespace mixins
+#endif
 
 SYSTEM_ERROR2_NAMESPACE_END
 
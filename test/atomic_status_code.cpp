@@ -0,0 +1,154 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "atomic_status_code.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+  printf("atomic_status_code is lock free = %d\n", static_cast<int>(atomic_system_code::is_always_lock_free));
+#if defined(__x86_64__) && defined(__GNUC__)
+  // The build enables cmpxchg16b, so the fallback should never be used here
+  CHECK(atomic_system_code::is_always_lock_free);
+#endif
+
+  // Single threaded semantics
+  {
+    atomic_system_code a;
+    CHECK(a.empty());
+    CHECK(a.load().empty());
+    system_code ec1(generic_code(errc::permission_denied)), ec2(generic_code(errc::timed_out));
+    CHECK(!a.try_set_if_empty(system_code()));
+    CHECK(a.try_set_if_empty(std::move(ec1)));
+    CHECK(ec1.empty());
+    CHECK(!a.empty());
+    CHECK(!a.try_set_if_empty(std::move(ec2)));
+    CHECK(!ec2.empty());
+    CHECK(a.load() == errc::permission_denied);
+    system_code old = a.exchange(std::move(ec2));
+    CHECK(ec2.empty());
+    CHECK(old == errc::permission_denied);
+    CHECK(a.load() == errc::timed_out);
+    old = a.exchange(system_code());
+    CHECK(old == errc::timed_out);
+    CHECK(a.empty());
+  }
+
+  // Codes with non-trivial erased values change owner correctly
+  {
+    atomic_system_code a;
+    system_code ec(make_status_code_ptr(generic_code(errc::no_such_file_or_directory)));
+    CHECK(a.try_set_if_empty(std::move(ec)));
+    CHECK(ec.empty());
+    system_code c1 = a.load(), c2 = a.load();
+    CHECK(c1 == errc::no_such_file_or_directory);
+    CHECK(c2 == errc::no_such_file_or_directory);
+    CHECK(c1.value() != c2.value());  // each load is a separate clone
+    system_code ec2(make_status_code_ptr(generic_code(errc::io_error)));
+    system_code old = a.exchange(std::move(ec2));
+    CHECK(old == errc::no_such_file_or_directory);
+    CHECK(a.load() == errc::io_error);
+    // The destructor frees the code still held
+  }
+
+  // atomic_error
+  {
+    atomic_error a;
+    CHECK(a.try_set_if_empty(error(errc::bad_address)));
+    CHECK(a.load() == errc::bad_address);
+  }
+
+  // Exactly one of many racing threads wins, and concurrent loads see either nothing or the winner
+  {
+    const unsigned threadcount = 8;
+    for(int round = 0; round < 100; round++)
+    {
+      atomic_system_code a;
+      std::atomic<unsigned> winners{0}, go{0};
+      std::atomic<bool> bad_load{false};
+      std::vector<std::thread> threads;
+      for(unsigned n = 0; n < threadcount; n++)
+      {
+        threads.emplace_back([&, n] {
+          ++go;
+          while(go < threadcount)
+          {
+          }
+          system_code ec(make_status_code_ptr(generic_code(static_cast<errc>(n + 1))));
+          if(a.try_set_if_empty(std::move(ec)))
+          {
+            ++winners;
+          }
+          system_code seen = a.load();
+          if(seen.empty() || !seen.failure())
+          {
+            bad_load = true;
+          }
+        });
+      }
+      for(auto &t : threads)
+      {
+        t.join();
+      }
+      CHECK(winners == 1);
+      CHECK(!bad_load);
+      CHECK(!a.empty());
+    }
+  }
+
+  // Concurrent loads and exchanges neither leak nor double free
+  {
+    atomic_system_code a;
+    std::atomic<bool> done{false};
+    std::thread loader([&] {
+      while(!done)
+      {
+        system_code c = a.load();
+        (void) c;
+      }
+    });
+    for(int n = 0; n < 10000; n++)
+    {
+      system_code old = a.exchange(make_status_code_ptr(generic_code(errc::io_error)));
+      (void) old;
+    }
+    done = true;
+    loader.join();
+  }
+
+  return retcode;
+}
@@ -0,0 +1,172 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bitcopy_vector.hpp"
+#include "result.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  CHECK((generic_code_domain.flags() & status_code_domain::flag_trivially_erasable) != 0);
+  CHECK((system_code(make_status_code_ptr(generic_code(errc::invalid_argument))).domain().flags() & status_code_domain::flag_trivially_erasable) == 0);
+
+  // Growth, erasure and destruction of erased codes, some of which own memory
+  {
+    bitcopy_vector<system_code> v;
+    CHECK(v.empty());
+    CHECK(v.capacity() == 0);
+    for(int n = 0; n < 1000; n++)
+    {
+      if(n % 3 == 0)
+      {
+        v.push_back(make_status_code_ptr(generic_code(errc::timed_out)));
+      }
+      else
+      {
+        v.emplace_back(generic_code(static_cast<errc>(n % 2 ? EINVAL : ENOENT)));
+      }
+    }
+    CHECK(v.size() == 1000);
+    CHECK(v.capacity() >= 1000);
+    CHECK(v[0] == errc::timed_out);
+    CHECK(v[1] == errc::invalid_argument);
+    CHECK(v[2] == errc::no_such_file_or_directory);
+    CHECK(!strcmp(v[999].message().c_str(), generic_code(errc::timed_out).message().c_str()));
+
+    auto it = v.erase(v.begin() + 1);
+    CHECK(it == v.begin() + 1);
+    CHECK(v.size() == 999);
+    CHECK(v[1] == errc::no_such_file_or_directory);
+    CHECK(v[2] == errc::timed_out);
+    it = v.erase(v.begin() + 10, v.begin() + 500);
+    CHECK(v.size() == 509);
+    CHECK(it == v.begin() + 10);
+    v.pop_back();
+    CHECK(v.size() == 508);
+    CHECK(v.back() == errc::no_such_file_or_directory);
+
+    // Pushing an item of ourselves while growing
+    v.shrink_to_fit();
+    CHECK(v.capacity() == v.size());
+    v.push_back(std::move(v[0]));
+    CHECK(v.size() == 509);
+    CHECK(v[0].empty());
+    CHECK(v.back() == errc::timed_out);
+
+    bitcopy_vector<system_code> w(std::move(v));
+    CHECK(v.empty());
+    CHECK(w.size() == 509);
+    v.swap(w);
+    CHECK(v.size() == 509);
+    CHECK(w.empty());
+    v.clear();
+    CHECK(v.empty());
+    CHECK(v.capacity() >= 509);
+
+    // Shrinking when empty frees
+    v.shrink_to_fit();
+    CHECK(v.capacity() == 0);
+    CHECK(v.data() == nullptr);
+    v.push_back(generic_code(errc::timed_out));
+    CHECK(v.size() == 1);
+
+    // Sizes beyond the address space fail to allocate
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+    bool threw = false;
+    try
+    {
+      v.reserve(static_cast<size_t>(-1) / 2);
+    }
+    catch(const std::bad_alloc &)
+    {
+      threw = true;
+    }
+    CHECK(threw);
+    CHECK(v.size() == 1);
+    CHECK(v[0] == errc::timed_out);
+#endif
+  }
+
+  // Errors
+  {
+    bitcopy_vector<error> v;
+    for(int n = 0; n < 100; n++)
+    {
+      v.emplace_back(generic_code(errc::permission_denied));
+      v.push_back(make_status_code_ptr(generic_code(errc::operation_canceled)));
+    }
+    CHECK(v.size() == 200);
+    CHECK(v[198] == errc::permission_denied);
+    CHECK(v[199] == errc::operation_canceled);
+    v.erase(v.begin(), v.begin() + 101);
+    CHECK(v.size() == 99);
+    CHECK(v[0] == errc::operation_canceled);
+  }
+
+#if __cplusplus >= 201703L || _HAS_CXX17
+  // Results
+  {
+    static_assert(traits::is_bitcopy_relocatable<result<int>>::value, "");
+    bitcopy_vector<result<int>> v;
+    for(int n = 0; n < 100; n++)
+    {
+      if(n % 2)
+      {
+        v.emplace_back(n);
+      }
+      else
+      {
+        v.emplace_back(make_status_code_ptr(generic_code(errc::bad_address)));
+      }
+    }
+    CHECK(v.size() == 100);
+    CHECK(v[99].has_value() && v[99].value() == 99);
+    CHECK(v[98].has_error() && v[98].error() == errc::bad_address);
+    v.erase(v.begin() + 2, v.end() - 2);
+    CHECK(v.size() == 4);
+    CHECK(v[2].has_error());
+    CHECK(v[3].value() == 99);
+
+    bitcopy_vector<result<void>> w;
+    w.emplace_back(in_place_type<void>);
+    w.emplace_back(generic_code(errc::no_buffer_space));
+    CHECK(w[0].has_value());
+    CHECK(w[1].error() == errc::no_buffer_space);
+  }
+#endif
+  return retcode;
+}
@@ -0,0 +1,117 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bitcopying_mpsc_queue.hpp"
+#include "system_code.hpp"
+
+#include "status_code_ptr.hpp"
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // Single threaded semantics, including wrapping around and codes with non-trivial erased values
+  {
+    bitcopying_mpsc_queue<system_code, 4> q;
+    system_code out;
+    CHECK(!q.try_pop(out));
+    for(int lap = 0; lap < 3; lap++)
+    {
+      for(int n = 0; n < 4; n++)
+      {
+        system_code ec(make_status_code_ptr(generic_code(static_cast<errc>(n + 1))));
+        CHECK(q.try_push(std::move(ec)));
+        CHECK(ec.empty());
+      }
+      system_code ec(generic_code(errc::io_error));
+      CHECK(!q.try_push(std::move(ec)));  // full
+      CHECK(!ec.empty());
+      CHECK(q.try_pop(out));
+      CHECK(out == static_cast<errc>(1));
+      system_code bulk[8];
+      CHECK(q.try_pop_bulk(bulk, 8) == 3);
+      CHECK(bulk[0] == static_cast<errc>(2));
+      CHECK(bulk[2] == static_cast<errc>(4));
+      CHECK(bulk[3].empty());
+    }
+    // The destructor frees items still queued
+    CHECK(q.try_push(make_status_code_ptr(generic_code(errc::io_error))));
+  }
+
+  // Many producers, one consumer: nothing lost or duplicated, and each producer's items arrive in order
+  {
+    const int producers = 4, items = 100000;
+    static bitcopying_mpsc_queue<system_code, 1024> q;
+    std::vector<std::thread> threads;
+    for(int p = 0; p < producers; p++)
+    {
+      threads.emplace_back([p] {
+        for(int n = 0; n < items; n++)
+        {
+          system_code ec(posix_code(p * items + n + 1));
+          while(!q.try_push(std::move(ec)))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    std::vector<int> next(producers, 0);
+    bool ordered = true;
+    int received = 0;
+    system_code bulk[64];
+    while(received < producers * items)
+    {
+      const size_t popped = q.try_pop_bulk(bulk, 64);
+      for(size_t n = 0; n < popped; n++)
+      {
+        const int v = static_cast<int>(bulk[n].value()) - 1;
+        const int p = v / items, i = v % items;
+        ordered = ordered && i == next[p];
+        next[p] = i + 1;
+      }
+      received += static_cast<int>(popped);
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    CHECK(ordered);
+    CHECK(!q.try_pop(bulk[0]));
+  }
+
+  return retcode;
+}
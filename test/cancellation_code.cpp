@@ -0,0 +1,105 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "cancellation_code.hpp"
+#include "system_code.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+// Cancellation codes construct as constants
+constexpr cancellation_code timed_out_code = make_status_code(cancellation_reason::timeout);
+static_assert(timed_out_code.reason() == cancellation_reason::timeout, "");
+static_assert(timed_out_code == errc::timed_out, "");
+static_assert(timed_out_code == errc::operation_canceled, "");
+static_assert(errc::operation_canceled == make_status_code(cancellation_reason::shutdown), "");
+static_assert(make_status_code(cancellation_reason::shutdown) != errc::timed_out, "");
+static_assert(make_status_code(cancellation_reason::user, 1234).reason_detail() == 1234, "");
+static_assert(make_status_code(cancellation_reason::none) == errc::success, "");
+static_assert(cancellation_code() != errc::operation_canceled, "");
+
+int main()
+{
+  int retcode = 0;
+
+  // Reasons, messages and failure
+  {
+    cancellation_code c1 = cancellation_reason::superseded, c2 = make_status_code(cancellation_reason::none);
+    CHECK(c1.failure());
+    CHECK(!c2.failure());
+    CHECK(c1.reason() == cancellation_reason::superseded);
+    CHECK(c1.reason_detail() == 0);
+    CHECK(!strcmp(c1.message().c_str(), "operation cancelled as superseded"));
+    CHECK(!strcmp(timed_out_code.message().c_str(), "operation cancelled due to timeout"));
+    const auto mine = static_cast<cancellation_reason>(static_cast<int>(cancellation_reason::user) + 1);
+    cancellation_code c3 = make_status_code(mine, 42);
+    CHECK(c3.reason() == mine);
+    CHECK(c3.reason_detail() == 42);
+    CHECK(c3 == errc::operation_canceled);
+    CHECK(c3.value() != make_status_code(mine, 43).value());
+    CHECK(c3 == make_status_code(mine, 42));
+  }
+
+  // Equivalence via the domain, once erased
+  {
+    system_code sc1(make_status_code(cancellation_reason::timeout)), sc2(cancellation_reason::shutdown);
+    CHECK(sc1.failure());
+    CHECK(sc1 == errc::timed_out);
+    CHECK(sc1 == errc::operation_canceled);
+    CHECK(sc2 == errc::operation_canceled);
+    CHECK(sc2 != errc::timed_out);
+    CHECK(sc1 == sc2);  // both are cancellations
+    CHECK(sc1.to_generic_code().value() == errc::timed_out);
+    CHECK(sc2.to_generic_code().value() == errc::operation_canceled);
+    CHECK(generic_code(errc::operation_canceled) == sc1);
+    CHECK(generic_code(errc::timed_out) != sc2);
+    CHECK(sc1 == timed_out_code);
+  }
+
+#ifdef SYSTEM_ERROR2_HAVE_STOP_TOKEN
+  // Conversion from a stop token
+  {
+    std::stop_source source;
+    cancellation_code c1 = cancellation_code::from_stop_token(source.get_token(), cancellation_reason::shutdown);
+    CHECK(!c1.failure());
+    source.request_stop();
+    cancellation_code c2 = cancellation_code::from_stop_token(source.get_token(), cancellation_reason::shutdown, 7);
+    CHECK(c2.failure());
+    CHECK(c2.reason() == cancellation_reason::shutdown);
+    CHECK(c2.reason_detail() == 7);
+    CHECK(c2 == errc::operation_canceled);
+    CHECK(cancellation_code::from_stop_token(source.get_token()).reason() == cancellation_reason::unspecified);
+  }
+#endif
+  return retcode;
+}
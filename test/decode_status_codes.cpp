@@ -0,0 +1,258 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "packed_status_code.hpp"
+#include "status_code_journal.hpp"
+#include "status_code_json.hpp"
+#include "status_code_wire.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+/* Writes known journal, wire and packed files, runs the decode-status-codes
+program given as the first argument on them, and compares its output with
+what it should be. Enough records are written for the program to use more
+than one thread when allowed to.
+*/
+
+namespace se2 = SYSTEM_ERROR2_NAMESPACE;
+
+static const size_t record_count = 5000;
+static const se2::status_code_domain::unique_id_type unknown_id = 0x1234;
+
+// The code of record n, or empty for a code of an unknown domain with value 5
+static se2::system_code code_of(size_t n)
+{
+  switch(n % 4)
+  {
+  case 0:
+    return se2::posix_code(ENOENT);
+  case 1:
+    return se2::generic_code(se2::errc::timed_out);
+  case 2:
+    return se2::nt_code(static_cast<se2::win32::NTSTATUS>(0xC0000022));
+  default:
+    return {};
+  }
+}
+
+static void write_le64(std::ofstream &out, uint64_t v)
+{
+  unsigned char buffer[8];
+  for(int n = 0; n < 8; n++)
+  {
+    buffer[n] = static_cast<unsigned char>(v >> (n * 8));
+  }
+  out.write(reinterpret_cast<const char *>(buffer), 8);
+}
+
+static std::string expected_code(const se2::system_code &code, const char *unknown, const char *format)
+{
+  char buffer[256];
+  if(code.empty())
+  {
+    if(0 == strcmp(format, "text"))
+      snprintf(buffer, sizeof(buffer), "unknown domain %s: 5", unknown);
+    else if(0 == strcmp(format, "csv"))
+      snprintf(buffer, sizeof(buffer), "\"%s\",,5,,", unknown);
+    else
+      snprintf(buffer, sizeof(buffer), "{\"id\":\"%s\",\"value\":5}", unknown);
+    return buffer;
+  }
+  const auto name = code.domain().name();
+  const auto msg = code.message();
+  if(0 == strcmp(format, "text"))
+  {
+    snprintf(buffer, sizeof(buffer), "%s: %s (%lld)", name.c_str(), msg.c_str(), static_cast<long long>(code.value()));
+  }
+  else if(0 == strcmp(format, "csv"))
+  {
+    snprintf(buffer, sizeof(buffer), "\"0x%016llx\",\"%s\",%lld,%d,\"%s\"", static_cast<unsigned long long>(code.domain().id()), name.c_str(), static_cast<long long>(code.value()), static_cast<int>(code.to_generic_code().value()), msg.c_str());
+  }
+  else
+  {
+    const size_t len = se2::json_encode(buffer, sizeof(buffer), code);
+    return std::string(buffer, len);
+  }
+  return buffer;
+}
+
+// What the program should output for the input `kind` in `format`
+static std::string expected(const char *kind, const char *format)
+{
+  const bool journal = (0 == strcmp(kind, "journal"));
+  std::string ret;
+  if(0 == strcmp(format, "csv"))
+  {
+    ret.append("timestamp,thread,site,domain_id,domain,value,errc,message\n");
+  }
+  for(size_t n = 0; n < record_count; n++)
+  {
+    char buffer[128];
+    if(journal)
+    {
+      if(0 == strcmp(format, "text"))
+        snprintf(buffer, sizeof(buffer), "1970-01-01T00:00:00.%09uZ thread %u site %u ", static_cast<unsigned>(n), static_cast<unsigned>(n % 3), static_cast<unsigned>(n % 7));
+      else if(0 == strcmp(format, "csv"))
+        snprintf(buffer, sizeof(buffer), "\"1970-01-01T00:00:00.%09uZ\",%u,%u,", static_cast<unsigned>(n), static_cast<unsigned>(n % 3), static_cast<unsigned>(n % 7));
+      else
+        snprintf(buffer, sizeof(buffer), "{\"timestamp\":%u,\"thread\":%u,\"site\":%u,\"code\":", static_cast<unsigned>(n), static_cast<unsigned>(n % 3), static_cast<unsigned>(n % 7));
+      ret.append(buffer);
+    }
+    else if(0 == strcmp(format, "csv"))
+    {
+      ret.append(",,,");
+    }
+    // Packed codes of unknown domains every eighth record are not in the dictionary
+    const char *unknown = (0 == strcmp(kind, "packed") && n % 8 == 7) ? "index 65" : "0x0000000000001234";
+    ret.append(expected_code(code_of(n), unknown, format));
+    if(journal && 0 == strcmp(format, "json"))
+    {
+      ret.push_back('}');
+    }
+    ret.push_back('\n');
+  }
+  return ret;
+}
+
+static void write_inputs()
+{
+  std::ofstream journal("decode-status-codes-test.journal", std::ios::binary), wire("decode-status-codes-test.wire", std::ios::binary), packed("decode-status-codes-test.packed", std::ios::binary);
+  se2::status_code_journal_header header{};
+  memcpy(header.magic, "se2jrnl", 8);
+  header.version = 1;
+  header.record_size = sizeof(se2::status_code_journal_record);
+  header.capacity = record_count + 1;
+  journal.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  se2::packed_status_code_dictionary dictionary;
+  for(size_t n = 0; n < record_count; n++)
+  {
+    const se2::system_code code = code_of(n);
+    se2::status_code_journal_record r{};
+    r.timestamp = n;
+    r.thread = n % 3;
+    r.site = n % 7;
+    r.domain_id = code.empty() ? unknown_id : code.domain().id();
+    r.value = code.empty() ? 5 : static_cast<int64_t>(code.value());
+    r.committed = 1;
+    journal.write(reinterpret_cast<const char *>(&r), sizeof(r));
+    if(n == record_count / 2)
+    {
+      // Reserved but never written, which is skipped
+      se2::status_code_journal_record uncommitted{};
+      uncommitted.domain_id = unknown_id;
+      journal.write(reinterpret_cast<const char *>(&uncommitted), sizeof(uncommitted));
+    }
+
+    unsigned char buffer[se2::wire_encoded_max_size];
+    size_t len = 0;
+    if(code.empty())
+    {
+      // An encoding of value 5 in an unknown domain
+      memset(buffer, 0, sizeof(buffer));
+      buffer[0] = static_cast<unsigned char>(unknown_id);
+      buffer[1] = static_cast<unsigned char>(unknown_id >> 8);
+      buffer[8] = 1;
+      buffer[9] = 5;
+      len = 10;
+    }
+    else
+    {
+      len = se2::wire_encode(buffer, sizeof(buffer), code);
+    }
+    wire.write(reinterpret_cast<const char *>(buffer), static_cast<std::streamsize>(len));
+
+    uint64_t bits = code.empty() ? ((static_cast<uint64_t>(dictionary.assign(unknown_id)) << 48) | 5) : se2::packed_status_code(code).bits();
+    if(n % 8 == 7)
+    {
+      bits = (static_cast<uint64_t>(se2::packed_status_code_dictionary::first_assigned_index + 1) << 48) | 5;
+    }
+    write_le64(packed, bits);
+  }
+  std::ofstream ids("decode-status-codes-test.dictionary", std::ios::binary);
+  for(auto id : dictionary.ids())
+  {
+    write_le64(ids, id);
+  }
+}
+
+static std::string read_file(const char *path)
+{
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream s;
+  s << in.rdbuf();
+  return s.str();
+}
+
+int main(int argc, char *argv[])
+{
+  int retcode = 0;
+  if(argc < 2)
+  {
+    fprintf(stderr, "Usage: %s <path to decode-status-codes>\n", argv[0]);
+    return 1;
+  }
+  write_inputs();
+  const char *kinds[] = {"journal", "wire", "packed"};
+  const char *formats[] = {"text", "csv", "json"};
+  const char *threads[] = {"1", "4"};
+  for(const char *kind : kinds)
+  {
+    for(const char *format : formats)
+    {
+      const std::string should_be = expected(kind, format);
+      for(const char *thread : threads)
+      {
+        std::string command = std::string("\"") + argv[1] + "\" --" + kind;
+        if(0 == strcmp(kind, "packed"))
+        {
+          command.append(" --dictionary decode-status-codes-test.dictionary");
+        }
+        command.append(" --format ").append(format).append(" --threads ").append(thread).append(" decode-status-codes-test.").append(kind).append(" > decode-status-codes-test.out");
+        const int ret = std::system(command.c_str());
+        CHECK(ret == 0);
+        const std::string output = read_file("decode-status-codes-test.out");
+        if(output != should_be)
+        {
+          fprintf(stderr, "--%s --format %s --threads %s output differs, it begins:\n%s\n", kind, format, thread, output.substr(0, 512).c_str());
+          retcode = 1;
+        }
+      }
+    }
+  }
+  return retcode;
+}
@@ -0,0 +1,273 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "epoll_reactor.hpp"
+
+#include <netinet/in.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  epoll_reactor reactor;
+  CHECK(reactor.open().has_value());
+  CHECK(reactor.open().has_error());  // already open
+
+  // Stream socketpair: a read waits for a write, end of stream, a failed write, cancellation
+  {
+    int sv[2];
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == 0);
+    CHECK(reactor.add(sv[0]).has_value());
+    CHECK(reactor.add(sv[1]).has_value());
+    CHECK((fcntl(sv[0], F_GETFL) & O_NONBLOCK) != 0);
+
+    char in[16] = {0};
+    int reads = 0;
+    size_t bytes = 0;
+    reactor.async_read(sv[1], in, sizeof(in), [&](result<size_t> r) {
+      ++reads;
+      bytes = r.has_value() ? r.value() : 999;
+    });
+    CHECK(reads == 0);
+    CHECK(reactor.outstanding() == 1);
+    int writes = 0;
+    reactor.async_write(sv[0], "hello", 5, [&](result<size_t> r) {
+      ++writes;
+      CHECK(r.has_value() && r.value() == 5);
+    });
+    CHECK(writes == 1);  // would not block, so completed immediately
+    auto done = reactor.run_once(1000);
+    CHECK(done.has_value() && done.value() == 1);
+    CHECK(reads == 1 && bytes == 5 && 0 == memcmp(in, "hello", 5));
+    CHECK(reactor.outstanding() == 0);
+
+    // Filling the send buffer parks writes until the peer reads
+    static char chunk[65536];
+    size_t parked_at = 0;
+    for(size_t n = 1; n < 1000 && reactor.outstanding() == 0; n++)
+    {
+      reactor.async_write(sv[0], chunk, sizeof(chunk), [&, n](result<size_t> r) {
+        CHECK(r.has_value());
+        if(n == parked_at)
+        {
+          ++writes;
+        }
+      });
+      parked_at = n;
+    }
+    CHECK(reactor.outstanding() == 1);
+    while(::recv(sv[1], chunk, sizeof(chunk), MSG_DONTWAIT) > 0)
+    {
+    }
+    for(int n = 0; n < 10 && reactor.outstanding() > 0; n++)
+    {
+      CHECK(reactor.run_once(1000).has_value());
+    }
+    CHECK(writes == 2);
+    while(::recv(sv[1], chunk, sizeof(chunk), MSG_DONTWAIT) > 0)
+    {
+    }
+
+    // Removal cancels what is outstanding
+    reactor.async_read(sv[1], in, sizeof(in), [&](result<size_t> r) {
+      ++reads;
+      CHECK(r.has_error() && r.error() == errc::operation_canceled);
+    });
+    CHECK(reactor.outstanding() == 1);
+    CHECK(reactor.remove(sv[1]).has_value());
+    CHECK(reads == 2);
+    CHECK(reactor.remove(sv[1]).has_error());
+    reactor.async_read(sv[1], in, sizeof(in), [&](result<size_t> r) {
+      ++reads;
+      CHECK(r.has_error() && r.error() == errc::bad_file_descriptor);
+    });
+    CHECK(reads == 3);
+
+    // End of stream, then writing to a closed peer
+    CHECK(reactor.add(sv[1]).has_value());
+    reactor.async_read(sv[1], in, sizeof(in), [&](result<size_t> r) {
+      ++reads;
+      CHECK(r.has_value() && r.value() == 0);
+    });
+    CHECK(reactor.remove(sv[0]).has_value());
+    ::close(sv[0]);
+    CHECK(reactor.run_once(1000).has_value());
+    CHECK(reads == 4);
+    reactor.async_write(sv[1], "x", 1, [&](result<size_t> r) {
+      ++writes;
+      CHECK(r.has_error() && r.error() == errc::broken_pipe);
+    });
+    CHECK(writes == 3);
+    CHECK(reactor.remove(sv[1]).has_value());
+    ::close(sv[1]);
+  }
+
+  // Loopback TCP: accept, connect, and a refused connection
+  {
+    const int listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addrlen = sizeof(addr);
+    CHECK(::bind(listener, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0);
+    CHECK(::listen(listener, 8) == 0);
+    CHECK(::getsockname(listener, reinterpret_cast<sockaddr *>(&addr), &addrlen) == 0);
+    CHECK(reactor.add(listener).has_value());
+
+    int accepted = -1, connected = 0;
+    reactor.async_accept(listener, [&](result<int> r) {
+      CHECK(r.has_value());
+      accepted = r.has_value() ? r.value() : -1;
+    });
+    const int client = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    CHECK(reactor.add(client).has_value());
+    reactor.async_connect(client, reinterpret_cast<sockaddr *>(&addr), sizeof(addr), [&](result<void> r) {
+      CHECK(r.has_value());
+      ++connected;
+    });
+    for(int n = 0; n < 10 && (accepted == -1 || connected == 0); n++)
+    {
+      CHECK(reactor.run_once(1000).has_value());
+    }
+    CHECK(accepted != -1 && connected == 1);
+    if(accepted != -1)
+    {
+      CHECK((fcntl(accepted, F_GETFL) & O_NONBLOCK) != 0);
+      CHECK(reactor.add(accepted).has_value());
+      char in[8] = {0};
+      size_t got = 0;
+      reactor.async_read(accepted, in, sizeof(in), [&](result<size_t> r) { got = r.has_value() ? r.value() : 0; });
+      reactor.async_write(client, "ping", 4, [](result<size_t>) {});
+      for(int n = 0; n < 10 && got == 0; n++)
+      {
+        CHECK(reactor.run_once(1000).has_value());
+      }
+      CHECK(got == 4 && 0 == memcmp(in, "ping", 4));
+      CHECK(reactor.remove(accepted).has_value());
+      ::close(accepted);
+    }
+    CHECK(reactor.remove(client).has_value());
+    ::close(client);
+    CHECK(reactor.remove(listener).has_value());
+    ::close(listener);
+
+    // Nothing listens on the port now
+    const int refused = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    CHECK(reactor.add(refused).has_value());
+    int failed = 0;
+    reactor.async_connect(refused, reinterpret_cast<sockaddr *>(&addr), sizeof(addr), [&](result<void> r) {
+      CHECK(r.has_error() && r.error() == errc::connection_refused);
+      ++failed;
+    });
+    for(int n = 0; n < 10 && failed == 0; n++)
+    {
+      CHECK(reactor.run_once(1000).has_value());
+    }
+    CHECK(failed == 1);
+    CHECK(reactor.remove(refused).has_value());
+    ::close(refused);
+  }
+
+  // Batches with per message codes, one of which fails
+  {
+    int sv[2];
+    CHECK(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sv) == 0);
+    CHECK(reactor.add(sv[0]).has_value());
+    CHECK(reactor.add(sv[1]).has_value());
+
+    char in[3][16];
+    iovec riov[3];
+    mmsghdr rmsgs[3];
+    posix_code rcodes[3];
+    memset(rmsgs, 0, sizeof(rmsgs));
+    for(int n = 0; n < 3; n++)
+    {
+      riov[n] = {in[n], sizeof(in[n])};
+      rmsgs[n].msg_hdr.msg_iov = &riov[n];
+      rmsgs[n].msg_hdr.msg_iovlen = 1;
+    }
+    unsigned received = 0;
+    reactor.async_recvmmsg(sv[1], rmsgs, rcodes, 3, [&](unsigned count) { received = count; });
+    CHECK(received == 0);
+
+    static char huge[4 * 1024 * 1024];
+    iovec siov[3] = {{const_cast<char *>("one"), 3}, {huge, sizeof(huge)}, {const_cast<char *>("three"), 5}};
+    mmsghdr smsgs[3];
+    posix_code scodes[3];
+    memset(smsgs, 0, sizeof(smsgs));
+    for(int n = 0; n < 3; n++)
+    {
+      smsgs[n].msg_hdr.msg_iov = &siov[n];
+      smsgs[n].msg_hdr.msg_iovlen = 1;
+    }
+    unsigned sent = 0;
+    reactor.async_sendmmsg(sv[0], smsgs, scodes, 3, [&](unsigned count) { sent = count; });
+    CHECK(sent == 3);
+    CHECK(scodes[0].success() && smsgs[0].msg_len == 3);
+    CHECK(scodes[1] == errc::message_size);
+    CHECK(scodes[2].success() && smsgs[2].msg_len == 5);
+
+    for(int n = 0; n < 10 && received == 0; n++)
+    {
+      CHECK(reactor.run_once(1000).has_value());
+    }
+    CHECK(received == 2);
+    CHECK(rcodes[0].success() && rmsgs[0].msg_len == 3 && 0 == memcmp(in[0], "one", 3));
+    CHECK(rcodes[1].success() && rmsgs[1].msg_len == 5 && 0 == memcmp(in[1], "three", 5));
+    ::close(sv[0]);
+    ::close(sv[1]);
+  }
+
+  // Closing the reactor cancels everything outstanding
+  {
+    int sv[2];
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == 0);
+    CHECK(reactor.add(sv[0]).has_value());
+    char in[4];
+    int cancelled = 0;
+    reactor.async_read(sv[0], in, sizeof(in), [&](result<size_t> r) { cancelled += (r.has_error() && r.error() == errc::operation_canceled); });
+    reactor.close();
+    CHECK(cancelled == 1);
+    CHECK(!reactor.is_open());
+    ::close(sv[0]);
+    ::close(sv[1]);
+  }
+
+  return retcode;
+}
@@ -0,0 +1,175 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "getaddrinfo_resolver.hpp"
+
+#if(__cplusplus >= 201703L || _HAS_CXX17) && __has_include(<variant>)
+
+#include <atomic>
+#include <cstdio>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+static getaddrinfo_resolver::result_type resolve(getaddrinfo_resolver &r, const char *host, const char *service, int flags = 0)
+{
+  std::promise<getaddrinfo_resolver::result_type> p;
+  auto f = p.get_future();
+  r.resolve(host, service, [&p](getaddrinfo_resolver::result_type res) { p.set_value(std::move(res)); }, AF_UNSPEC, SOCK_STREAM, flags);
+  return f.get();
+}
+
+int main()
+{
+  int retcode = 0;
+
+  // localhost always resolves, even offline, and is cached
+  {
+    getaddrinfo_resolver r;
+    auto a = resolve(r, "localhost", "80", AI_NUMERICSERV);
+    CHECK(a.has_value());
+    if(a.has_value())
+    {
+      CHECK(!a.value()->empty());
+      for(auto &i : *a.value())
+      {
+        CHECK(i.family == AF_INET || i.family == AF_INET6);
+        CHECK(i.socktype == SOCK_STREAM);
+      }
+      printf("localhost resolved to %zu addresses\n", a.value()->size());
+    }
+    auto b = resolve(r, "localhost", "80", AI_NUMERICSERV);
+    CHECK(b.has_value());
+    CHECK(b.has_value() && a.has_value() && b.value() == a.value());
+    CHECK(r.stats().lookups == 1);
+    CHECK(r.stats().cache_hits == 1);
+  }
+
+  // A name which does not exist fails with a getaddrinfo_code, and is negatively cached
+  {
+    getaddrinfo_resolver r;
+    auto a = resolve(r, "localhost", "notaservice", AI_NUMERICSERV);
+    CHECK(a.has_error());
+    if(a.has_error())
+    {
+      CHECK(a.error().domain() == getaddrinfo_code_domain);
+      CHECK(a.error() == getaddrinfo_code(EAI_NONAME));
+      CHECK(a.error() == errc::no_such_device_or_address);
+      printf("notaservice failed with '%s'\n", a.error().message().c_str());
+    }
+    auto b = resolve(r, "localhost", "notaservice", AI_NUMERICSERV);
+    CHECK(b.has_error());
+    CHECK(r.stats().lookups == 1);
+  }
+
+  // Expired answers are looked up again
+  {
+    getaddrinfo_resolver::config cfg;
+    cfg.negative_ttl = std::chrono::seconds(0);
+    getaddrinfo_resolver r(cfg);
+    resolve(r, "localhost", "notaservice", AI_NUMERICSERV);
+    resolve(r, "localhost", "notaservice", AI_NUMERICSERV);
+    CHECK(r.stats().lookups == 2);
+  }
+
+  // Concurrent lookups of the same query share one call to getaddrinfo()
+  {
+    const size_t count = 64;
+    getaddrinfo_resolver r;
+    std::vector<std::promise<bool>> done(count);
+    for(size_t n = 0; n < count; n++)
+    {
+      r.resolve("127.0.0.1", "443", [&done, n](getaddrinfo_resolver::result_type res) { done[n].set_value(res.has_value()); }, AF_INET, SOCK_STREAM, AI_NUMERICHOST | AI_NUMERICSERV);
+    }
+    bool ok = true;
+    for(auto &i : done)
+    {
+      ok = ok && i.get_future().get();
+    }
+    CHECK(ok);
+    const auto stats = r.stats();
+    printf("%zu lookups, %zu cache hits, %zu coalesced\n", stats.lookups, stats.cache_hits, stats.coalesced);
+    CHECK(stats.lookups == 1);
+    CHECK(stats.lookups + stats.cache_hits + stats.coalesced == count);
+  }
+
+  // Lookups not yet started are cancelled by destruction
+  {
+    std::vector<std::future<bool>> cancelled;
+    // Hold the only worker in the first lookup's handler until the last of the others has been cancelled
+    std::promise<void> started, release;
+    std::shared_future<void> released(release.get_future());
+    std::atomic<int> cancellations{0};
+    bool worker_released = false;
+    {
+      getaddrinfo_resolver::config cfg;
+      cfg.threads = 1;
+      getaddrinfo_resolver r(cfg);
+      r.resolve("127.0.0.1", "", [&started, &worker_released, released](getaddrinfo_resolver::result_type /*unused*/) {
+        started.set_value();
+        // Times out only if destruction failed to cancel every other lookup
+        worker_released = (released.wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+      }, AF_INET, 0, AI_NUMERICHOST);
+      for(int n = 1; n <= 15; n++)
+      {
+        auto p = std::make_shared<std::promise<bool>>();
+        cancelled.push_back(p->get_future());
+        r.resolve("127.0.0." + std::to_string(n + 1), "", [p, &cancellations, &release](getaddrinfo_resolver::result_type res) {
+          const bool was_cancelled = res.has_error() && res.error() == errc::operation_canceled;
+          p->set_value(was_cancelled);
+          if(was_cancelled && ++cancellations == 15)
+          {
+            release.set_value();
+          }
+        }, AF_INET, 0, AI_NUMERICHOST);
+      }
+      started.get_future().wait();
+    }
+    // The worker was released by the cancellations, so none of the others started
+    CHECK(worker_released);
+    size_t count = 0;
+    for(auto &i : cancelled)
+    {
+      count += static_cast<size_t>(i.get());
+    }
+    CHECK(count == 15);
+  }
+
+  return retcode;
+}
+#else
+int main()
+{
+  return 0;
+}
+#endif
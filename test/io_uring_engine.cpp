@@ -0,0 +1,188 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "io_uring_engine.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  io_uring_engine ring;
+  // Flags which the engine cannot honour are refused before asking the kernel
+  CHECK(ring.open(8, IORING_SETUP_SQPOLL).error() == errc::invalid_argument);
+  CHECK(ring.open(8, IORING_SETUP_CQSIZE).error() == errc::invalid_argument);
+#ifdef IORING_SETUP_SQE128
+  CHECK(ring.open(8, IORING_SETUP_SQE128).error() == errc::invalid_argument);
+#endif
+#ifdef IORING_SETUP_NO_SQARRAY
+  CHECK(ring.open(8, IORING_SETUP_NO_SQARRAY).error() == errc::invalid_argument);
+#endif
+  CHECK(ring.open(8, IORING_SETUP_CLAMP | (1U << 31)).error() == errc::invalid_argument);
+  CHECK(!ring.is_open());
+  {
+    auto r = ring.open(8);
+    if(r.has_error())
+    {
+      // Kernels without io_uring, or where it is disabled, as in many containers
+      if(r.error() == errc::function_not_supported || r.error() == errc::operation_not_permitted || r.error() == errc::permission_denied)
+      {
+        fprintf(stderr, "io_uring is not available (%s), skipping\n", r.error().message().c_str());
+        return 0;
+      }
+      fprintf(stderr, "io_uring_engine::open() failed with %s\n", r.error().message().c_str());
+      return 1;
+    }
+  }
+  CHECK(ring.is_open());
+  CHECK(ring.sq_entries() == 8);
+  CHECK(ring.open(8).has_error());  // already open
+
+  // Batched submission, a full submission queue, and reaping
+  {
+    unsigned prepared = 0;
+    while(ring.prep_nop(100 + prepared) != nullptr)
+    {
+      ++prepared;
+    }
+    CHECK(prepared == 8);
+    CHECK(ring.pending() == 8);
+    auto submitted = ring.submit(8);
+    CHECK(submitted.has_value() && submitted.value() == 8);
+    CHECK(ring.pending() == 0);
+    CHECK(ring.ready() == 8);
+    io_uring_engine::completion out[4];
+    CHECK(ring.reap(out, 4) == 4);
+    CHECK(out[0].user_data == 100 && out[0].res == 0 && !out[0].has_error());
+    uint64_t sum = 0;
+    CHECK(ring.for_each_completion([&](const io_uring_engine::completion &c) { sum += c.user_data; }) == 4);
+    CHECK(sum == 104 + 105 + 106 + 107);
+    CHECK(ring.ready() == 0);
+  }
+
+  // Failures become posix codes without errno being touched
+  {
+    char c;
+    CHECK(ring.prep_read(-1, &c, 1, 0, 1) != nullptr);
+    CHECK(ring.wait(1).has_value());
+    io_uring_engine::completion out[1];
+    errno = 0;
+    CHECK(ring.reap(out, 1) == 1);
+    CHECK(out[0].has_error());
+    CHECK(out[0].code() == errc::bad_file_descriptor);
+    auto r = out[0].to_result();
+    CHECK(r.has_error() && r.error() == errc::bad_file_descriptor);
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    CHECK(errno == 0);
+#endif
+  }
+
+  // Linked file operations, and a failure cancelling what it is linked to
+  const char *path = "io_uring_engine_test.tmp";
+  auto fd = posix_io::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  CHECK(fd.has_value());
+  if(fd.has_value())
+  {
+    const int h = fd.value();
+    char in[16] = {0};
+    CHECK(ring.prep_write(h, "hello world", 11, 0, 1, IOSQE_IO_LINK) != nullptr);
+    CHECK(ring.prep_fsync(h, 2, IOSQE_IO_LINK) != nullptr);
+    CHECK(ring.prep_read(h, in, sizeof(in), 0, 3) != nullptr);
+    CHECK(ring.wait(3).has_value());
+    std::vector<io_uring_engine::completion> cs;
+    ring.for_each_completion([&](const io_uring_engine::completion &c) { cs.push_back(c); });
+    CHECK(cs.size() == 3);
+    if(cs.size() == 3)
+    {
+      CHECK(cs[0].user_data == 1 && cs[0].to_result().value() == 11);
+      CHECK(cs[1].user_data == 2 && cs[1].res == 0);
+      CHECK(cs[2].user_data == 3 && cs[2].to_result().value() == 11);
+      CHECK(0 == memcmp(in, "hello world", 11));
+    }
+
+    CHECK(ring.prep_read(-1, in, 1, 0, 4, IOSQE_IO_LINK) != nullptr);
+    CHECK(ring.prep_write(h, "!", 1, 11, 5) != nullptr);
+    CHECK(ring.wait(2).has_value());
+    io_uring_engine::completion out[2];
+    CHECK(ring.reap(out, 2) == 2);
+    CHECK(out[0].user_data == 4 && out[0].code() == errc::bad_file_descriptor);
+    CHECK(out[1].user_data == 5 && out[1].code() == errc::operation_canceled);
+
+    // Registered buffers and files
+    alignas(4096) static char buffer[4096];
+    struct iovec iov = {buffer, sizeof(buffer)};
+    CHECK(ring.register_buffers(&iov, 1).has_value());
+    CHECK(ring.register_files(&h, 1).has_value());
+    memcpy(buffer, "FIXED", 5);
+    CHECK(ring.prep_write_fixed(0, buffer, 5, 0, 0, 6, IOSQE_FIXED_FILE | IOSQE_IO_LINK) != nullptr);
+    CHECK(ring.prep_read_fixed(0, buffer + 100, 11, 0, 0, 7, IOSQE_FIXED_FILE) != nullptr);
+    CHECK(ring.wait(2).has_value());
+    CHECK(ring.reap(out, 2) == 2);
+    CHECK(out[0].user_data == 6 && out[0].res == 5);
+    CHECK(out[1].user_data == 7 && out[1].res == 11);
+    CHECK(0 == memcmp(buffer + 100, "FIXED world", 11));
+    CHECK(ring.unregister_files().has_value());
+    CHECK(ring.unregister_buffers().has_value());
+
+    CHECK(ring.prep_close(h, 8) != nullptr);
+    CHECK(ring.wait(1).has_value());
+    CHECK(ring.reap(out, 1) == 1 && out[0].user_data == 8 && !out[0].has_error());
+    unlink(path);
+  }
+
+  // Sockets
+  {
+    int sv[2];
+    CHECK(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == 0);
+    char in[8] = {0};
+    CHECK(ring.prep_recv(sv[1], in, sizeof(in), 1) != nullptr);
+    CHECK(ring.prep_send(sv[0], "ping", 4, 2) != nullptr);
+    CHECK(ring.wait(2).has_value());
+    io_uring_engine::completion out[2];
+    CHECK(ring.reap(out, 2) == 2);
+    for(auto &c : out)
+    {
+      CHECK(c.to_result().has_value() && c.to_result().value() == 4);
+    }
+    CHECK(0 == memcmp(in, "ping", 4));
+    ::close(sv[0]);
+    ::close(sv[1]);
+  }
+
+  ring.close();
+  CHECK(!ring.is_open());
+  return retcode;
+}
@@ -22,9 +22,8 @@ Distributed under the Boost Software License, Version 1.0.
 http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#ifdef _WIN32
 #include "com_code.hpp"
-#else
+#ifndef _WIN32
 #include "getaddrinfo_code.hpp"
 #endif
 
@@ -486,13 +485,12 @@ int main()
     CHECK(0 == strcmp(shared_str3.c_str(), msg));
   }
 
-#ifdef _WIN32
-  // Test win32_code
+  // Test win32_code, which also decodes codes reported by Windows machines on other platforms
   constexpr win32_code success5(0 /*ERROR_SUCCESS*/), failure5(0x5 /*ERROR_ACCESS_DENIED*/);
   CHECK(success5.success());
   CHECK(failure5.failure());
-  printf("\nWin32 code success has value %lu (%s) is success %d is failure %d\n", success5.value(), success5.message().c_str(), static_cast<int>(success5.success()), static_cast<int>(success5.failure()));
-  printf("Win32 code failure has value %lu (%s) is success %d is failure %d\n", failure5.value(), failure5.message().c_str(), static_cast<int>(failure5.success()), static_cast<int>(failure5.failure()));
+  printf("\nWin32 code success has value %lu (%s) is success %d is failure %d\n", static_cast<unsigned long>(success5.value()), success5.message().c_str(), static_cast<int>(success5.success()), static_cast<int>(success5.failure()));
+  printf("Win32 code failure has value %lu (%s) is success %d is failure %d\n", static_cast<unsigned long>(failure5.value()), failure5.message().c_str(), static_cast<int>(failure5.success()), static_cast<int>(failure5.failure()));
   CHECK(success5 == errc::success);
   CHECK(failure5 == errc::permission_denied);
   CHECK(failure5 == failure1);
@@ -503,19 +501,21 @@ int main()
   CHECK(failure6 == failure1);
   CHECK(failure6 == failure2);
 
+#ifdef _WIN32
   // Test mixin
   {
     SetLastError(99);
     win32_code m = win32_code::current();
     CHECK(m.value() == 99);
   }
+#endif
 
   // Test nt_code
   constexpr nt_code success7(1 /* positive */), failure7(0xC0000022 /*STATUS_ACCESS_DENIED*/);
   CHECK(success7.success());
   CHECK(failure7.failure());
-  printf("\nNT code success has value %ld (%s) is success %d is failure %d\n", success7.value(), success7.message().c_str(), static_cast<int>(success7.success()), static_cast<int>(success7.failure()));
-  printf("NT code warning has value %ld (%s) is success %d is failure %d\n", failure7.value(), failure7.message().c_str(), static_cast<int>(failure7.success()), static_cast<int>(failure7.failure()));
+  printf("\nNT code success has value %ld (%s) is success %d is failure %d\n", static_cast<long>(success7.value()), success7.message().c_str(), static_cast<int>(success7.success()), static_cast<int>(success7.failure()));
+  printf("NT code warning has value %ld (%s) is success %d is failure %d\n", static_cast<long>(failure7.value()), failure7.message().c_str(), static_cast<int>(failure7.success()), static_cast<int>(failure7.failure()));
   CHECK(success7 == errc::success);
   CHECK(failure7 == errc::permission_denied);
   CHECK(failure7 == failure1);
@@ -531,15 +531,15 @@ int main()
   // Test com_code
   {
     // Does com_code correctly handle a wrapped Win32 error code?
-    com_code win32failure(HRESULT_FROM_WIN32(0x5 /*ERROR_ACCESS_DENIED*/));
-    printf("\nCOM code win32 failure has value %ld (%s) is success %d is failure %d\n", win32failure.value(), win32failure.message().c_str(), static_cast<int>(win32failure.success()), static_cast<int>(win32failure.failure()));
+    com_code win32failure(0x80070005 /*HRESULT_FROM_WIN32(ERROR_ACCESS_DENIED)*/);
+    printf("\nCOM code win32 failure has value %ld (%s) is success %d is failure %d\n", static_cast<long>(win32failure.value()), win32failure.message().c_str(), static_cast<int>(win32failure.success()), static_cast<int>(win32failure.failure()));
     CHECK(win32failure == errc::permission_denied);
     CHECK(win32failure == failure5);
     CHECK(win32failure == failure7);
 
     // Does com_code correctly handle a wrapped Win32 error code?
-    com_code ntfailure(HRESULT_FROM_NT(0xC0000022 /*STATUS_ACCESS_DENIED*/));
-    printf("COM code nt failure has value %ld (%s) is success %d is failure %d\n", ntfailure.value(), ntfailure.message().c_str(), static_cast<int>(ntfailure.success()), static_cast<int>(ntfailure.failure()));
+    com_code ntfailure(0xD0000022 /*HRESULT_FROM_NT(STATUS_ACCESS_DENIED)*/);
+    printf("COM code nt failure has value %ld (%s) is success %d is failure %d\n", static_cast<long>(ntfailure.value()), ntfailure.message().c_str(), static_cast<int>(ntfailure.success()), static_cast<int>(ntfailure.failure()));
     CHECK(ntfailure == errc::permission_denied);
     CHECK(ntfailure == failure5);
     CHECK(ntfailure == failure7);
@@ -548,24 +548,61 @@ int main()
     // Does com_code correctly handle the common HRESULT codes?
     const std::pair<com_code, errc> common[] = {
     //
-    {com_code(S_OK), errc::success},                      //
-    {com_code(E_ACCESSDENIED), errc::permission_denied},  //
-    {com_code(E_INVALIDARG), errc::invalid_argument},     //
-    {com_code(E_OUTOFMEMORY), errc::not_enough_memory}    //
+    {com_code(0 /*S_OK*/), errc::success},                           //
+    {com_code(0x80070005 /*E_ACCESSDENIED*/), errc::permission_denied},  //
+    {com_code(0x80070057 /*E_INVALIDARG*/), errc::invalid_argument},     //
+    {com_code(0x8007000E /*E_OUTOFMEMORY*/), errc::not_enough_memory}    //
     };
     for(auto &i : common)
     {
       auto &c = i.first;
       auto &e = i.second;
-      printf("COM code common has value %ld (%s) is success %d is failure %d\n", c.value(), c.message().c_str(), static_cast<int>(c.success()), static_cast<int>(c.failure()));
+      printf("COM code common has value %ld (%s) is success %d is failure %d\n", static_cast<long>(c.value()), c.message().c_str(), static_cast<int>(c.success()), static_cast<int>(c.failure()));
       CHECK(c == e);
     }
   }
-#else
+#ifndef _WIN32
+  // Test the embedded messages used when FormatMessage() is unavailable
+  {
+    CHECK(0 == strcmp(failure5.message().c_str(), "ERROR_ACCESS_DENIED: Access is denied."));
+    CHECK(0 == strcmp(failure7.message().c_str(), "STATUS_ACCESS_DENIED: A process has requested access to an object but has not been granted those access rights."));
+    CHECK(0 == strcmp(com_code(0xD0000022).message().c_str(), failure7.message().c_str()));
+    CHECK(0 == strcmp(com_code(0x80070005).message().c_str(), failure5.message().c_str()));
+    CHECK(0 == strcmp(com_code(0x80004005 /*E_FAIL*/).message().c_str(), "E_FAIL: Unspecified error."));
+    CHECK(0 == strcmp(win32_code(0xFFFF).message().c_str(), "unknown win32 code 0x0000ffff"));
+    CHECK(0 == strcmp(com_code(0x8badf00d).message().c_str(), "unknown COM code 0x8badf00d"));
+  }
+
   // Test getaddrinfo_code
   getaddrinfo_code gai(EAI_NONAME);
   CHECK(gai == errc::no_such_device_or_address);
   printf("\ngetaddrinfo_code says the string for EAI_NONAME is '%s'\n", gai.message().c_str());
+  CHECK(gai.eai() == EAI_NONAME);
+  CHECK(gai.system_errno() == 0);
+  {
+    // EAI_SYSTEM preserves the errno which caused it
+    getaddrinfo_code gaisys = getaddrinfo_code::from_return(EAI_SYSTEM, EMFILE);
+    CHECK(gaisys.failure());
+    CHECK(gaisys.eai() == EAI_SYSTEM);
+    CHECK(gaisys.system_errno() == EMFILE);
+    CHECK(gaisys == errc::too_many_files_open);
+    CHECK(gaisys != errc::resource_unavailable_try_again);
+    CHECK(gaisys != getaddrinfo_code(EAI_SYSTEM));
+    CHECK(getaddrinfo_code::from_return(EAI_NONAME, EMFILE) == gai);
+    CHECK(getaddrinfo_code::from_return(0, EMFILE).success());
+    printf("getaddrinfo_code says the string for EAI_SYSTEM with EMFILE is '%s'\n", gaisys.message().c_str());
+    CHECK(strstr(gaisys.message().c_str(), strerror(EMFILE)) != nullptr);
+    CHECK(gaisys.message().data() == gaisys.message().data());  // not allocated
+    // Errno values beyond those of the platform still have their text
+    const std::string unknown = strerror(4000);
+    CHECK(strstr(getaddrinfo_code::from_return(EAI_SYSTEM, 4000).message().c_str(), unknown.c_str()) != nullptr);
+    system_code sc(gaisys);
+    CHECK(sc == errc::too_many_files_open);
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    CHECK(gaisys == posix_code(EMFILE));
+    CHECK(gai != posix_code(EMFILE));
+#endif
+  }
 #endif
 
 #ifndef SYSTEM_ERROR2_NOT_POSIX
@@ -577,6 +614,8 @@ int main()
   printf("POSIX code failure has value %d (%s) is success %d is failure %d\n", failure9.value(), failure9.message().c_str(), static_cast<int>(failure9.success()), static_cast<int>(failure9.failure()));
   CHECK(success9 == errc::success);
   CHECK(failure9 == errc::permission_denied);
+  CHECK(failure9.to_generic_code().value() == errc::permission_denied);
+  CHECK(system_code().to_generic_code().empty());
   CHECK(failure9 == failure1);
   CHECK(failure9 == failure2);
   system_code success10(success9), failure10(failure9);
@@ -0,0 +1,122 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "packed_status_code.hpp"
+#include "posix_code.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // Empty is the zero word
+  {
+    packed_status_code p{system_code()};
+    CHECK(p.empty());
+    CHECK(p.bits() == 0);
+    CHECK(p.to_system_code().empty());
+    CHECK(packed_status_code::from_bits(0).empty());
+  }
+
+  // Codes of this library's domains round trip, and group by domain
+  {
+    packed_status_code p1{system_code(posix_code(ENOENT))}, p2{system_code(posix_code(EACCES))}, p3{system_code(generic_code(errc::no_such_file_or_directory))};
+    CHECK(!p1.empty());
+    CHECK(p1.domain_index() == 2);
+    CHECK(p3.domain_index() == 1);
+    CHECK(p1.value() == ENOENT);
+    CHECK((p1.bits() >> 48) == (p2.bits() >> 48));
+    CHECK((p1.bits() >> 48) != (p3.bits() >> 48));
+    system_code sc = p1.to_system_code();
+    CHECK(sc.domain() == posix_code_domain);
+    CHECK(sc.value() == ENOENT);
+    CHECK(packed_status_code::from_bits(p2.bits()) == p2);
+    CHECK(packed_status_code::from_bits(p2.bits()).to_system_code() == errc::permission_denied);
+  }
+
+  // Negative values are sign extended from 48 bits
+  {
+    packed_status_code p{system_code(nt_code(static_cast<win32::NTSTATUS>(0xC0000022)))};  // STATUS_ACCESS_DENIED
+    CHECK(p.value() == static_cast<win32::NTSTATUS>(0xC0000022));
+    system_code sc = p.to_system_code();
+    CHECK(sc.domain() == nt_code_domain);
+    CHECK(sc == errc::permission_denied);
+  }
+
+  // Codes which cannot be packed become their generic code
+  {
+    system_code sc = make_status_code_ptr(posix_code(EBUSY));
+    packed_status_code p{sc};
+    CHECK(p.domain_index() == packed_status_code_dictionary::fixed_index_of(generic_code_domain.id()));
+    CHECK(p.to_system_code() == errc::device_or_resource_busy);
+    packed_status_code_dictionary dictionary;
+    packed_status_code q{sc, dictionary};
+    CHECK(q == p);
+    CHECK(dictionary.ids().empty());
+  }
+
+  // Fixed indices do not depend on which domains are linked in
+  {
+    CHECK(packed_status_code_dictionary::fixed_index_of(generic_code_domain.id()) == 1);
+    CHECK(packed_status_code_dictionary::fixed_index_of(posix_code_domain.id()) == 2);
+    CHECK(packed_status_code_dictionary::fixed_index_of(nt_code_domain.id()) == 4);
+    CHECK(packed_status_code_dictionary::fixed_index_of(0x1234) == 0);
+    packed_status_code_dictionary dictionary;
+    CHECK(dictionary.id_of(2) == posix_code_domain.id());
+    CHECK(dictionary.id_of(packed_status_code_dictionary::first_assigned_index) == 0);
+  }
+
+  // Other domains are assigned indices, which survive storage of the dictionary
+  {
+    packed_status_code_dictionary dictionary;
+    CHECK(dictionary.index_of(0x1234) == 0);
+    CHECK(dictionary.assign(0x1234) == packed_status_code_dictionary::first_assigned_index);
+    CHECK(dictionary.assign(0x5678) == packed_status_code_dictionary::first_assigned_index + 1);
+    CHECK(dictionary.assign(0x1234) == packed_status_code_dictionary::first_assigned_index);
+    CHECK(dictionary.assign(posix_code_domain.id()) == 2);
+    CHECK(dictionary.ids().size() == 2);
+    packed_status_code_dictionary loaded(dictionary.ids().data(), dictionary.ids().size());
+    CHECK(loaded.id_of(packed_status_code_dictionary::first_assigned_index + 1) == 0x5678);
+    CHECK(loaded.index_of(0x1234) == packed_status_code_dictionary::first_assigned_index);
+  }
+
+  // Unknown domain indices convert to empty
+  {
+    CHECK(packed_status_code::from_bits(static_cast<uint64_t>(0xfffe) << 48).to_system_code().empty());
+    CHECK(packed_status_code::from_bits(static_cast<uint64_t>(packed_status_code_dictionary::first_assigned_index) << 48).to_system_code().empty());
+  }
+  return retcode;
+}
@@ -0,0 +1,104 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "portable_status_code.hpp"
+#include "posix_code.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // Empty round trips to empty
+  {
+    portable_status_code p{system_code()};
+    CHECK(p.empty());
+    CHECK(p.domain_id() == 0);
+    CHECK(p == portable_status_code());
+    CHECK(p.to_system_code().empty());
+  }
+
+  // Codes of trivially erasable domains keep their domain and value
+  {
+    portable_status_code p{system_code(posix_code(ENOENT))};
+    CHECK(p.domain_id() == posix_code_domain.id());
+    CHECK(p.value() == ENOENT);
+    system_code sc = p.to_system_code();
+    CHECK(sc.domain() == posix_code_domain);
+    CHECK(sc.value() == ENOENT);
+    CHECK(sc == errc::no_such_file_or_directory);
+  }
+  {
+    portable_status_code p{system_code(nt_code(static_cast<win32::NTSTATUS>(0xC0000034)))};  // STATUS_OBJECT_NAME_NOT_FOUND
+    CHECK(p.value() < 0);
+    system_code sc = p.to_system_code();
+    CHECK(sc.domain() == nt_code_domain);
+    CHECK(sc.value() == static_cast<win32::NTSTATUS>(0xC0000034));
+    CHECK(sc == errc::no_such_file_or_directory);
+  }
+
+  // Codes whose value refers to memory of this process become their generic code
+  {
+    system_code sc = make_status_code_ptr(posix_code(EACCES));
+    portable_status_code p{sc};
+    CHECK(p.domain_id() == generic_code_domain.id());
+    CHECK(p.value() == EACCES);
+    CHECK(p.to_system_code() == errc::permission_denied);
+  }
+
+  // Unregistered domains, and values too large for this process, convert to empty
+  {
+    CHECK(portable_status_code(0x1234, 5).to_system_code().empty());
+    if(sizeof(intptr_t) < sizeof(int64_t))
+    {
+      CHECK(portable_status_code(posix_code_domain.id(), INT64_MAX).to_system_code().empty());
+    }
+  }
+
+  // Survives being copied through raw bytes, as shared memory would
+  {
+    unsigned char shm[sizeof(portable_status_code) * 2];
+    const portable_status_code in{system_code(posix_code(EINTR))};
+    memcpy(shm + sizeof(portable_status_code), &in, sizeof(in));
+    portable_status_code out;
+    memcpy(&out, shm + sizeof(portable_status_code), sizeof(out));
+    CHECK(out == in);
+    CHECK(out.to_system_code() == errc::interrupted);
+  }
+
+  return retcode;
+}
@@ -0,0 +1,101 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "posix_io.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+  const char *path = "posix_io_test.tmp";
+
+  // Failures are posix codes
+  {
+    errno = 0;
+    auto r = posix_io::open("/nonexistent/posix_io_test", O_RDONLY);
+    CHECK(r.has_error());
+    if(r.has_error())
+    {
+      CHECK(r.error().domain() == posix_code_domain);
+      CHECK(r.error() == errc::no_such_file_or_directory);
+    }
+#if SYSTEM_ERROR2_POSIX_IO_RAW_SYSCALLS
+    CHECK(errno == 0);  // errno is not involved
+#endif
+    char c;
+    auto r2 = posix_io::read(-1, &c, 1);
+    CHECK(r2.has_error() && r2.error() == errc::bad_file_descriptor);
+    CHECK(posix_io::fstat(-1).has_error());
+    CHECK(posix_io::close(-1).has_error());
+    CHECK(posix_io::fsync(-1).has_error());
+  }
+
+  // Writing and reading back
+  {
+    auto fd = posix_io::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    CHECK(fd.has_value());
+    if(fd.has_value())
+    {
+      const int h = fd.value();
+      CHECK(posix_io::write(h, "hello ", 6).value() == 6);
+      char a[] = "big ", b[] = "world";
+      struct iovec iov[2] = {{a, 4}, {b, 5}};
+      CHECK(posix_io::writev(h, iov, 2).value() == 9);
+      CHECK(posix_io::pwrite(h, "HELLO", 5, 0).value() == 5);
+      CHECK(posix_io::fsync(h).has_value());
+      auto st = posix_io::fstat(h);
+      CHECK(st.has_value() && st.value().st_size == 15 && S_ISREG(st.value().st_mode));
+
+      char buffer[32] = {0};
+      CHECK(posix_io::pread(h, buffer, sizeof(buffer), 6).value() == 9);
+      CHECK(0 == memcmp(buffer, "big world", 9));
+      CHECK(lseek(h, 0, SEEK_SET) == 0);
+      memset(buffer, 0, sizeof(buffer));
+      CHECK(posix_io::read(h, buffer, 6).value() == 6);
+      CHECK(0 == memcmp(buffer, "HELLO ", 6));
+      char c[4] = {0}, d[8] = {0};
+      struct iovec riov[2] = {{c, 4}, {d, 8}};
+      CHECK(posix_io::readv(h, riov, 2).value() == 9);
+      CHECK(0 == memcmp(c, "big ", 4) && 0 == memcmp(d, "world", 5));
+      CHECK(posix_io::read(h, buffer, sizeof(buffer)).value() == 0);  // end of file
+      CHECK(posix_io::close(h).has_value());
+      auto again = posix_io::close(h);
+      CHECK(again.has_error() && again.error() == errc::bad_file_descriptor);
+    }
+    unlink(path);
+  }
+
+  return retcode;
+}
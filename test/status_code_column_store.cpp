@@ -0,0 +1,120 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "status_code_column_store.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  status_code_column_store store;
+  CHECK(store.empty());
+  CHECK(store.count_failures() == 0);
+  CHECK(store.group_by_domain().empty());
+
+  store.reserve(16);
+  store.push_back(posix_code(0));
+  store.push_back(posix_code(ENOENT));
+  store.push_back(posix_code(ENOENT));
+  store.push_back(generic_code(errc::no_such_file_or_directory));
+  store.push_back(generic_code(errc::success));
+  store.push_back(nt_code(static_cast<win32::NTSTATUS>(0xC0000034)));  // STATUS_OBJECT_NAME_NOT_FOUND
+  store.push_back(nt_code(0));
+  store.push_back(system_code());
+  store.push_back(make_status_code_ptr(posix_code(EACCES)));
+  store.push_back(posix_code(EACCES));
+  CHECK(store.size() == 10);
+
+  // Codes read back as they went in, except the indirected one which is now generic
+  CHECK(store[1].domain() == posix_code_domain);
+  CHECK(store[1].value() == ENOENT);
+  CHECK(store[5].domain() == nt_code_domain);
+  CHECK(store[7].empty());
+  CHECK(store[8].domain() == generic_code_domain);
+  CHECK(store[8] == errc::permission_denied);
+
+  // Queries agree with calling each code one at a time
+  size_t failures = 0, enoent = 0, eacces = 0, success = 0;
+  for(size_t n = 0; n < store.size(); n++)
+  {
+    failures += store[n].failure();
+    enoent += (store[n] == errc::no_such_file_or_directory);
+    eacces += (store[n] == errc::permission_denied);
+    success += (store[n] == errc::success);
+  }
+  CHECK(failures == 6);
+  CHECK(store.count_failures() == failures);
+  CHECK(enoent == 4);
+  CHECK(store.count_equivalent(errc::no_such_file_or_directory) == enoent);
+  CHECK(store.count_equivalent(errc::permission_denied) == eacces);
+  CHECK(store.count_equivalent(errc::success) == success);
+
+  // Grouped in order of first appearance
+  {
+    auto groups = store.group_by_domain();
+    CHECK(groups.size() == 4);
+    CHECK(*groups[0].domain == posix_code_domain);
+    CHECK(groups[0].count == 4);
+    CHECK(*groups[1].domain == generic_code_domain);
+    CHECK(groups[1].count == 3);
+    CHECK(*groups[2].domain == nt_code_domain);
+    CHECK(groups[2].count == 2);
+    CHECK(groups[3].domain == nullptr);
+    CHECK(groups[3].count == 1);
+  }
+
+  // Another copy of a domain, as each shared object may have, is the same domain
+  {
+    static constexpr _posix_code_domain other_posix_code_domain;
+    CHECK(&other_posix_code_domain != &posix_code_domain);
+    system_code other;
+    CHECK(detail::wire_codec::rebuild(other, &other_posix_code_domain, ENOENT, nullptr, 0));
+    status_code_column_store copies;
+    copies.push_back(posix_code(ENOENT));
+    copies.push_back(other);
+    copies.push_back(posix_code(EACCES));
+    CHECK(copies.count_failures() == 3);
+    CHECK(copies.count_equivalent(errc::no_such_file_or_directory) == 2);
+    auto groups = copies.group_by_domain();
+    CHECK(groups.size() == 1);
+    CHECK(groups[0].count == 3);
+  }
+
+  store.clear();
+  CHECK(store.empty());
+  return retcode;
+}
@@ -0,0 +1,113 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "cancellation_code.hpp"
+#include "com_code.hpp"
+#include "nt_code.hpp"
+#include "status_code_domain_registry.hpp"
+#include "system_code.hpp"
+
+#include <cstdio>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+enum class RegisteredCode
+{
+  success,
+  failure
+};
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+template <> struct quick_status_code_from_enum<RegisteredCode> : quick_status_code_from_enum_defaults<RegisteredCode>
+{
+  static constexpr const auto domain_name = "Registered Code";
+  static constexpr const auto domain_uuid = "{6e1a92f4-0b7d-4c38-a5e2-19d3f08c7b61}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {RegisteredCode::success, "Success", {errc::success}},           //
+    {RegisteredCode::failure, "Failure", {errc::invalid_argument}},  //
+    };
+    return v;
+  }
+};
+SYSTEM_ERROR2_NAMESPACE_END
+#if __cplusplus >= 201402L || defined(_MSC_VER)
+SYSTEM_ERROR2_REGISTER_DOMAIN(SYSTEM_ERROR2_NAMESPACE::quick_status_code_from_enum_domain<RegisteredCode>);
+#endif
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+#if defined(__ELF__) || defined(__APPLE__) || defined(_MSC_VER)
+  printf("%u domains are registered\n", static_cast<unsigned>(status_code_domain_registry::size()));
+  CHECK(status_code_domain_registry::size() >= 6);
+  CHECK(status_code_domain_registry::find(generic_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(generic_code_domain.id())->id() == generic_code_domain.id());
+  CHECK(status_code_domain_registry::find(posix_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(nt_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(win32_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(com_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(cancellation_code_domain.id()) != nullptr);
+  CHECK(status_code_domain_registry::find(0xdeadbeef) == nullptr);
+  CHECK(status_code_domain_registry::at(status_code_domain_registry::index_of(posix_code_domain.id())) == status_code_domain_registry::find(posix_code_domain.id()));
+  CHECK(status_code_domain_registry::index_of(0xdeadbeef) == status_code_domain_registry::size());
+  CHECK(status_code_domain_registry::at(status_code_domain_registry::size()) == nullptr);
+#if __cplusplus >= 201402L || defined(_MSC_VER)
+  {
+    const status_code_domain *d = status_code_domain_registry::find(quick_status_code_from_enum_domain<RegisteredCode>.id());
+    CHECK(d != nullptr);
+    CHECK(d != nullptr && !strcmp(d->name().c_str(), "Registered Code"));
+  }
+#endif
+
+  // Sorted by unique id, without duplicates
+  {
+    const status_code_domain *last = nullptr;
+    size_t count = 0;
+    for(const status_code_domain *d : status_code_domain_registry())
+    {
+      CHECK(last == nullptr || last->id() < d->id());
+      last = d;
+      ++count;
+    }
+    CHECK(count == status_code_domain_registry::size());
+  }
+
+  // A code can be rebuilt from its domain id and value
+  {
+    system_code original(posix_code(EACCES));
+    const status_code_domain *d = status_code_domain_registry::find(original.domain().id());
+    CHECK(d != nullptr && *d == posix_code_domain);
+    CHECK(d != nullptr && !strcmp(d->name().c_str(), "posix domain"));
+  }
+#endif
+  return retcode;
+}
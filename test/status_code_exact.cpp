@@ -0,0 +1,132 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "system_code.hpp"
+#include "status_code_exact.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cstdio>
+#include <map>
+#include <unordered_map>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+  exact_hash hash;
+  exact_equal equal;
+  exact_less less;
+
+  // Exact, not semantic
+  {
+    generic_code g1(errc::invalid_argument), g2(errc::invalid_argument), g3(errc::timed_out);
+    posix_code p1(EINVAL);
+    CHECK(g1 == p1);
+    CHECK(!equal(g1, p1));
+    CHECK(equal(g1, g2));
+    CHECK(!equal(g1, g3));
+    CHECK(hash(g1) == hash(g2));
+    CHECK(hash(g1) != hash(g3));
+    CHECK(hash(g1) != hash(p1));
+    CHECK(less(g1, g3) != less(g3, g1));
+    CHECK(!less(g1, g2) && !less(g2, g1));
+  }
+
+  // Typed and erased forms of the same code are the same
+  {
+    generic_code g(errc::permission_denied);
+    system_code s(g);
+    CHECK(equal(g, s));
+    CHECK(equal(s, g));
+    CHECK(hash(g) == hash(s));
+    CHECK(!less(g, s) && !less(s, g));
+  }
+
+  // Including negative values, which are sign extended when erased
+  {
+    posix_code p(-1);
+    system_code ps(p);
+    CHECK(equal(p, ps));
+    CHECK(equal(ps, p));
+    CHECK(hash(p) == hash(ps));
+    CHECK(!less(p, ps) && !less(ps, p));
+    nt_code n(static_cast<win32::NTSTATUS>(0xC0000022));
+    system_code ns(n);
+    CHECK(equal(n, ns));
+    CHECK(equal(ns, n));
+    CHECK(hash(n) == hash(ns));
+    CHECK(!less(n, ns) && !less(ns, n));
+    const system_code other(nt_code(static_cast<win32::NTSTATUS>(0x00000103)));
+    CHECK(less(n, other) == less(ns, other));
+    CHECK(less(other, n) == less(other, ns));
+  }
+
+  // Empty codes
+  {
+    system_code e1, e2, s(generic_code(errc::permission_denied));
+    CHECK(equal(e1, e2));
+    CHECK(!equal(e1, s));
+    CHECK(less(e1, s));
+    CHECK(!less(s, e1));
+    CHECK(hash(e1) == hash(e2));
+  }
+
+  // Pointer payload domains compare what they point to
+  {
+    system_code p1(make_status_code_ptr(generic_code(errc::bad_address))), p2(make_status_code_ptr(generic_code(errc::bad_address))), p3(make_status_code_ptr(generic_code(errc::io_error)));
+    CHECK(equal(p1, p2));
+    CHECK(hash(p1) == hash(p2));
+    CHECK(!equal(p1, p3));
+    CHECK(less(p1, p3) != less(p3, p1));
+    CHECK(!equal(p1, system_code(generic_code(errc::bad_address))));
+  }
+
+  // Use in containers
+  {
+    std::unordered_map<system_code, int, exact_hash, exact_equal> counts;
+    std::map<system_code, int, exact_less> ordered;
+    for(int n = 0; n < 1000; n++)
+    {
+      const int errcode = (n % 3 == 0) ? EINVAL : (n % 3 == 1) ? ENOENT : EACCES;
+      counts[system_code(generic_code(static_cast<errc>(errcode)))]++;
+      counts[system_code(posix_code(errcode))]++;
+      ordered[system_code(posix_code(errcode))]++;
+    }
+    CHECK(counts.size() == 6);
+    CHECK(ordered.size() == 3);
+    CHECK(counts.find(generic_code(errc::invalid_argument)) != counts.end());
+    CHECK(counts.find(generic_code(errc::invalid_argument))->second == 334);
+    CHECK(counts.find(posix_code(ENOENT))->second == 333);
+    CHECK(ordered.find(posix_code(EACCES))->second == 333);
+  }
+  return retcode;
+}
@@ -0,0 +1,151 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_histogram.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // Many threads recording codes from several domains
+  {
+    const int threadcount = 4, iterations = 10000;
+    status_code_histogram h;
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadcount; t++)
+    {
+      threads.emplace_back([&h] {
+        for(int n = 0; n < iterations; n++)
+        {
+          h.record(generic_code(errc::permission_denied));
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+          h.record(posix_code(EACCES));
+          h.record(posix_code(ENOENT));
+#endif
+          h.record(system_code());  // ignored
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    const auto entries = h.snapshot();
+    for(auto &e : entries)
+    {
+      printf("%s value %ld occurred %llu times\n", e.domain->name().c_str(), static_cast<long>(e.value), static_cast<unsigned long long>(e.count));
+    }
+    CHECK(h.dropped() == 0);
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    CHECK(entries.size() == 3);
+    CHECK(h.total() == 3ULL * threadcount * iterations);
+#else
+    CHECK(entries.size() == 1);
+    CHECK(h.total() == 1ULL * threadcount * iterations);
+#endif
+    for(auto &e : entries)
+    {
+      CHECK(e.count == 1ULL * threadcount * iterations);
+    }
+
+    // The rollup merges EACCES from both domains
+    const auto rollup = h.by_errc();
+    for(auto &i : rollup)
+    {
+      printf("errc %d occurred %llu times\n", static_cast<int>(i.first), static_cast<unsigned long long>(i.second));
+    }
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    CHECK(rollup.size() == 2);
+    CHECK(rollup.size() == 2 && rollup[0].first == errc::no_such_file_or_directory && rollup[0].second == 1ULL * threadcount * iterations);
+    CHECK(rollup.size() == 2 && rollup[1].first == errc::permission_denied && rollup[1].second == 2ULL * threadcount * iterations);
+#endif
+  }
+
+  // Codes beyond a shard's capacity are counted as dropped
+  {
+    status_code_histogram h(4);
+    for(int n = 1; n <= 6; n++)
+    {
+      h.record(generic_code(static_cast<errc>(n)));
+    }
+    CHECK(h.snapshot().size() == 4);
+    CHECK(h.dropped() == 2);
+  }
+
+  // Codes whose value does not outlive them are counted as their generic code
+  {
+    status_code_histogram h;
+    h.record(make_status_code_ptr(generic_code(errc::timed_out)));
+    h.record(generic_code(errc::timed_out));
+    const auto entries = h.snapshot();
+    CHECK(entries.size() == 1);
+    CHECK(entries.size() == 1 && entries[0].domain == &generic_code_domain && entries[0].count == 2);
+    const auto rollup = h.by_errc();
+    CHECK(rollup.size() == 1 && rollup[0].first == errc::timed_out && rollup[0].second == 2);
+  }
+
+
+  // A thread alternating between more histograms than it caches records into each correctly
+  {
+    std::vector<std::unique_ptr<status_code_histogram>> hs;
+    for(int n = 0; n < 12; n++)
+    {
+      hs.emplace_back(new status_code_histogram(16));
+    }
+    for(int round = 0; round < 100; round++)
+    {
+      for(auto &h : hs)
+      {
+        h->record(generic_code(errc::timed_out));
+      }
+    }
+    hs.erase(hs.begin() + 3);
+    hs.emplace_back(new status_code_histogram(16));
+    for(auto &h : hs)
+    {
+      h->record(generic_code(errc::io_error));
+    }
+    for(size_t n = 0; n < hs.size(); n++)
+    {
+      CHECK(hs[n]->total() == ((n + 1 < hs.size()) ? 101U : 1U));
+      CHECK(hs[n]->dropped() == 0);
+    }
+  }
+
+  return retcode;
+}
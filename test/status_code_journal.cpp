@@ -0,0 +1,175 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_journal.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+#if defined(__unix__) || defined(__APPLE__)
+// Reads the committed records of segment `index` of the journal at `prefix`
+static std::vector<SYSTEM_ERROR2_NAMESPACE::status_code_journal_record> read_segment(const char *prefix, unsigned index, SYSTEM_ERROR2_NAMESPACE::status_code_journal_header &header)
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  std::vector<status_code_journal_record> ret;
+  char path[256];
+  snprintf(path, sizeof(path), "%s.%06u", prefix, index);
+  FILE *f = fopen(path, "rb");
+  if(f == nullptr)
+  {
+    header.capacity = 0;
+    return ret;
+  }
+  if(fread(&header, sizeof(header), 1, f) == 1)
+  {
+    status_code_journal_record r;
+    for(uint64_t n = 0; n < header.capacity && fread(&r, sizeof(r), 1, f) == 1; n++)
+    {
+      if(r.committed != 0)
+      {
+        ret.push_back(r);
+      }
+    }
+  }
+  fclose(f);
+  return ret;
+}
+static void remove_segments(const char *prefix)
+{
+  char path[256];
+  for(unsigned n = 0; n < 100; n++)
+  {
+    snprintf(path, sizeof(path), "%s.%06u", prefix, n);
+    remove(path);
+  }
+}
+#endif
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+#if defined(__unix__) || defined(__APPLE__)
+  const char *prefix = "test-status-code-journal";
+  remove_segments(prefix);
+
+  // Records land in the first segment
+  {
+    status_code_journal journal;
+    CHECK(!journal.is_open());
+    CHECK(!journal.record(posix_code(ENOENT)));
+    CHECK(journal.dropped() == 1);
+    CHECK(journal.open(prefix, 4096).success());
+    CHECK(journal.is_open());
+    CHECK(journal.record(posix_code(ENOENT), 42));
+    CHECK(journal.record(make_status_code_ptr(posix_code(EACCES))));
+    CHECK(!journal.record(system_code()));
+    journal.flush();
+
+    status_code_journal_header header;
+    const auto records = read_segment(prefix, 0, header);
+    CHECK(std::string(header.magic) == "se2jrnl");
+    CHECK(header.version == 1);
+    CHECK(header.record_size == sizeof(status_code_journal_record));
+    CHECK(header.segment == 0);
+    CHECK(header.capacity == 4096 / 64 - 1);
+    CHECK(records.size() == 2);
+    if(records.size() == 2)
+    {
+      CHECK(records[0].domain_id == posix_code_domain.id());
+      CHECK(records[0].value == ENOENT);
+      CHECK(records[0].site == 42);
+      CHECK(records[0].thread != 0);
+      CHECK(records[0].timestamp != 0);
+      // Codes whose value does not outlive them are recorded as their generic code
+      CHECK(records[1].domain_id == generic_code_domain.id());
+      CHECK(records[1].value == EACCES);
+    }
+  }
+
+  // Reopening starts a new segment, and full segments rotate, across many threads
+  {
+    status_code_journal journal;
+    CHECK(journal.open(prefix, 4096).success());
+    std::vector<std::thread> threads;
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([&journal, n] {
+        for(int m = 0; m < 100; m++)
+        {
+          journal.record(posix_code(m), static_cast<uint64_t>(n));
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    CHECK(journal.dropped() == 0);
+    journal.close();
+
+    size_t total = 0, sum = 0;
+    unsigned segments = 0;
+    status_code_journal_header header;
+    for(unsigned index = 1;; index++)
+    {
+      const auto records = read_segment(prefix, index, header);
+      if(header.capacity == 0)
+      {
+        break;
+      }
+      CHECK(header.segment == index);
+      ++segments;
+      total += records.size();
+      for(const auto &r : records)
+      {
+        sum += static_cast<size_t>(r.value);
+      }
+    }
+    CHECK(segments >= 7);  // 400 records at 63 a segment, less the rest of blocks reserved when a segment is replaced
+    CHECK(total == 400);
+    CHECK(sum == 4 * (99 * 100 / 2));
+  }
+
+  // Failing to open returns why
+  {
+    status_code_journal journal;
+    CHECK(journal.open("no/such/directory/journal") == errc::no_such_file_or_directory);
+    CHECK(!journal.is_open());
+  }
+  remove_segments(prefix);
+#endif
+  return retcode;
+}
@@ -0,0 +1,119 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_json.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+enum class QuotedCode
+{
+  plain,
+  quoted,
+  control
+};
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+template <> struct quick_status_code_from_enum<QuotedCode> : quick_status_code_from_enum_defaults<QuotedCode>
+{
+  static constexpr const auto domain_name = "Quoted \"Code\"";
+  static constexpr const auto domain_uuid = "{9f4e27b1-58c3-4d06-b7a2-e10c36d98f54}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {QuotedCode::plain, "A message long enough to be scanned a word at a time", {errc::invalid_argument}},  //
+    {QuotedCode::quoted, "Path \"C:\\temp\" not found", {errc::no_such_file_or_directory}},               //
+    {QuotedCode::control, "Line one\nline two\ttabbed\x01", {}},                                          //
+    };
+    return v;
+  }
+};
+SYSTEM_ERROR2_NAMESPACE_END
+
+static std::string json(const SYSTEM_ERROR2_NAMESPACE::system_code &code)
+{
+  char buffer[512];
+  const size_t len = SYSTEM_ERROR2_NAMESPACE::json_encode(buffer, sizeof(buffer), code);
+  return (len <= sizeof(buffer)) ? std::string(buffer, len) : std::string();
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  CHECK(json(system_code()) == "null");
+  {
+    const std::string j = json(generic_code(errc::no_such_file_or_directory));
+    CHECK(j == "{\"domain\":\"generic domain\",\"id\":\"0x746d6354f4f733e9\",\"value\":" + std::to_string(ENOENT) + ",\"errc\":" + std::to_string(ENOENT) + ",\"message\":\"No such file or directory\"}");
+  }
+  {
+    const std::string j = json(posix_code(EACCES));
+    CHECK(j.find("\"domain\":\"posix domain\"") != std::string::npos);
+    CHECK(j.find("\"id\":\"0xa59a56fe5f310933\"") != std::string::npos);
+    CHECK(j.find("\"value\":" + std::to_string(EACCES) + ",") != std::string::npos);
+  }
+  {
+    const std::string j = json(quick_status_code_from_enum_code<QuotedCode>(QuotedCode::plain));
+    CHECK(j.find("\"domain\":\"Quoted \\\"Code\\\"\"") != std::string::npos);
+    CHECK(j.find("\"message\":\"A message long enough to be scanned a word at a time\"") != std::string::npos);
+    CHECK(j.find("\"errc\":" + std::to_string(EINVAL) + ",") != std::string::npos);
+  }
+  {
+    const std::string j = json(quick_status_code_from_enum_code<QuotedCode>(QuotedCode::quoted));
+    CHECK(j.find("\"message\":\"Path \\\"C:\\\\temp\\\" not found\"}") != std::string::npos);
+  }
+  {
+    const std::string j = json(quick_status_code_from_enum_code<QuotedCode>(QuotedCode::control));
+    CHECK(j.find("\"message\":\"Line one\\nline two\\ttabbed\\u0001\"}") != std::string::npos);
+    CHECK(j.find("\"errc\":-1,") != std::string::npos);
+  }
+
+  // Codes whose erased value is not their value
+  {
+    const std::string j = json(make_status_code_ptr(posix_code(EBUSY)));
+    CHECK(j.find("\"value\":null,") != std::string::npos);
+    CHECK(j.find("\"errc\":" + std::to_string(EBUSY) + ",") != std::string::npos);
+  }
+
+  // Too small a buffer returns the length needed, and is not overrun
+  {
+    char buffer[32];
+    memset(buffer, 'x', sizeof(buffer));
+    const system_code code = posix_code(ENOENT);
+    const size_t len = json_encode(buffer, 16, code);
+    CHECK(len == json(code).size());
+    CHECK(buffer[16] == 'x');
+  }
+  return retcode;
+}
@@ -0,0 +1,213 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_log_limiter.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+struct logged
+{
+  intptr_t value;
+  const char *site;
+  uint64_t repeats;
+};
+static std::atomic<unsigned> logged_count{0};
+static logged logged_lines[64];
+
+static void test_sink(void *context, const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code, const char *site, uint64_t repeats)
+{
+  (void) context;
+  const unsigned n = logged_count++;
+  if(n < 64)
+  {
+    logged_lines[n] = logged{static_cast<const SYSTEM_ERROR2_NAMESPACE::system_code &>(code).value(), site, repeats};
+  }
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+  using clock = status_code_log_limiter::clock;
+  const auto t0 = clock::now();
+  const auto s = [&](int n) { return t0 + std::chrono::seconds(n); };
+
+  // The first occurrence is logged, repeats in the window are only counted
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::seconds(10), 64);
+    const system_code refused = posix_code(ECONNREFUSED);
+    CHECK(limiter.log(refused, nullptr, s(0)));
+    for(int n = 0; n < 1000; n++)
+    {
+      CHECK(!limiter.log(refused, nullptr, s(1)));
+    }
+    CHECK(logged_count == 1);
+    CHECK(logged_lines[0].value == ECONNREFUSED);
+    CHECK(logged_lines[0].repeats == 0);
+
+    // Different values and call sites are different keys
+    static const char site[] = "connect()";
+    CHECK(limiter.log(posix_code(ETIMEDOUT), nullptr, s(2)));
+    CHECK(limiter.log(refused, site, s(2)));
+    CHECK(!limiter.log(refused, site, s(3)));
+    CHECK(logged_count == 3);
+    CHECK(logged_lines[2].site == site);
+
+    // Flushing before the window ends does nothing
+    limiter.flush(s(5));
+    CHECK(logged_count == 3);
+
+    // After the window, the next occurrence logs a summary then itself
+    CHECK(limiter.log(refused, nullptr, s(11)));
+    CHECK(logged_count == 5);
+    CHECK(logged_lines[3].repeats == 1000);
+    CHECK(logged_lines[4].repeats == 0);
+
+    // Flushing after the window summarises the keys which did not recur
+    limiter.flush(s(20));
+    CHECK(logged_count == 6);
+    CHECK(logged_lines[5].value == ECONNREFUSED);
+    CHECK(logged_lines[5].site == site);
+    CHECK(logged_lines[5].repeats == 1);
+    limiter.flush(s(30));
+    CHECK(logged_count == 6);
+    CHECK(limiter.untracked() == 0);
+  }
+
+  // Codes whose value does not outlive them are keyed by their generic code
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::seconds(10), 64);
+    system_code a = make_status_code_ptr(posix_code(EACCES)), b = make_status_code_ptr(posix_code(EACCES));
+    CHECK(limiter.log(a, nullptr, s(0)));
+    CHECK(!limiter.log(b, nullptr, s(1)));
+    limiter.flush(clock::time_point::max());
+    CHECK(logged_count == 2);
+    CHECK(logged_lines[1].value == EACCES);
+    CHECK(logged_lines[1].repeats == 1);
+  }
+
+  // When the table is full, codes are logged every time
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::seconds(10), 2);
+    CHECK(limiter.log(posix_code(1), nullptr, s(0)));
+    CHECK(limiter.log(posix_code(2), nullptr, s(0)));
+    CHECK(limiter.log(posix_code(3), nullptr, s(0)));
+    CHECK(limiter.log(posix_code(3), nullptr, s(0)));
+    CHECK(limiter.untracked() == 2);
+
+    // Flushing frees the slots of keys whose window ended
+    limiter.flush(s(11));
+    CHECK(limiter.log(posix_code(3), nullptr, s(12)));
+    CHECK(!limiter.log(posix_code(3), nullptr, s(13)));
+    CHECK(limiter.log(posix_code(4), nullptr, s(13)));
+    CHECK(!limiter.log(posix_code(4), nullptr, s(14)));
+    CHECK(limiter.untracked() == 2);
+    limiter.flush(clock::time_point::max());
+    CHECK(logged_count == 8);
+    CHECK(logged_lines[6].repeats == 1 && logged_lines[7].repeats == 1);
+  }
+
+  // Keys are not duplicated when slots before them are freed
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::seconds(10), 2);
+    CHECK(limiter.log(posix_code(1), nullptr, s(0)));
+    CHECK(limiter.log(posix_code(2), nullptr, s(5)));
+    limiter.flush(s(11));
+    CHECK(!limiter.log(posix_code(2), nullptr, s(12)));
+    CHECK(!limiter.log(posix_code(2), nullptr, s(12)));
+    CHECK(logged_count == 2);
+  }
+
+  // Keys are freed and claimed again while many threads log
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::seconds(1), 4);
+    std::atomic<bool> done{false};
+    std::thread flusher([&] {
+      for(int m = 0; !done; m++)
+      {
+        limiter.flush(s(m));
+      }
+    });
+    std::vector<std::thread> threads;
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([&, n] {
+        for(int m = 0; m < 10000; m++)
+        {
+          limiter.log(posix_code(1 + (m + n) % 3), nullptr, s(m / 1000));
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    done = true;
+    flusher.join();
+    limiter.flush(clock::time_point::max());
+    CHECK(limiter.untracked() == 0);
+  }
+
+  // Many threads logging the same code log it once
+  {
+    logged_count = 0;
+    status_code_log_limiter limiter(test_sink, nullptr, std::chrono::hours(1), 64);
+    std::vector<std::thread> threads;
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([&] {
+        for(int m = 0; m < 10000; m++)
+        {
+          limiter.log(posix_code(ECONNREFUSED));
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    CHECK(logged_count == 1);
+    CHECK(limiter.untracked() == 0);
+    limiter.flush(clock::time_point::max());
+    CHECK(logged_count == 2);
+    CHECK(logged_lines[1].repeats == 39999);
+  }
+  return retcode;
+}
@@ -0,0 +1,181 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_logger.hpp"
+#include "error.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+struct captured
+{
+  std::mutex lock;
+  std::string text;
+  size_t batches{0};
+
+  static void sink(void *context, const char *lines, size_t length)
+  {
+    auto *self = static_cast<captured *>(context);
+    std::lock_guard<std::mutex> g(self->lock);
+    self->text.append(lines, length);
+    ++self->batches;
+  }
+  std::vector<std::string> lines()
+  {
+    std::lock_guard<std::mutex> g(lock);
+    std::vector<std::string> ret;
+    size_t start = 0;
+    for(size_t n = text.find('\n'); n != std::string::npos; start = n + 1, n = text.find('\n', start))
+    {
+      ret.push_back(text.substr(start, n - start));
+    }
+    return ret;
+  }
+};
+
+static bool ends_with(const std::string &s, const char *suffix)
+{
+  const size_t len = strlen(suffix);
+  return s.size() >= len && s.compare(s.size() - len, len, suffix) == 0;
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // Formatting of timestamps, arguments, domain and message
+  {
+    captured c;
+    status_code_logger logger(captured::sink, &c);
+    CHECK(logger.log("read of fd {} at {} of {} failed{}", posix_code(ENOENT), 5, static_cast<int64_t>(-1), static_cast<uint64_t>(-1)));
+    CHECK(!logger.log("empty", system_code()));
+    logger.flush();
+    const auto lines = c.lines();
+    CHECK(lines.size() == 1);
+    if(lines.size() == 1)
+    {
+      // 2026-10-17T11:51:11.258694286Z
+      CHECK(lines[0].size() > 31 && lines[0][4] == '-' && lines[0][10] == 'T' && lines[0][29] == 'Z' && lines[0][30] == ' ');
+      CHECK(ends_with(lines[0], " read of fd 5 at -1 of 18446744073709551615 failed{}: posix domain: No such file or directory"));
+    }
+    CHECK(logger.dropped() == 0);
+  }
+
+  // Codes with payloads are kept until formatted, lvalues are copied, error and typed codes convert
+  {
+    captured c;
+    status_code_logger logger(captured::sink, &c);
+    system_code ptr = make_status_code_ptr(posix_code(EACCES));
+    CHECK(logger.log("clone", ptr));
+    CHECK(!ptr.empty());
+    CHECK(logger.log("moved", std::move(ptr)));
+    CHECK(ptr.empty());
+    const system_code trivial(posix_code(EINTR));
+    CHECK(logger.log("copy", trivial));
+    CHECK(!trivial.empty());
+    error e(errc::bad_address);
+    CHECK(logger.log("error", std::move(e)));
+    const posix_code typed(EAGAIN);
+    CHECK(logger.log("typed", typed));
+    logger.flush();
+    const auto lines = c.lines();
+    CHECK(lines.size() == 5);
+    if(lines.size() == 5)
+    {
+      CHECK(ends_with(lines[0], " clone: posix domain: Permission denied"));
+      CHECK(ends_with(lines[1], " moved: posix domain: Permission denied"));
+      CHECK(ends_with(lines[2], " copy: posix domain: Interrupted system call"));
+      CHECK(ends_with(lines[3], " error: generic domain: Bad address"));
+      CHECK(ends_with(lines[4], " typed: posix domain: Resource temporarily unavailable"));
+    }
+  }
+
+  // Destruction writes everything still queued
+  {
+    captured c;
+    {
+      status_code_logger logger(captured::sink, &c, std::chrono::hours(1));
+      CHECK(logger.log("late", make_status_code_ptr(posix_code(EIO))));
+    }
+    const auto lines = c.lines();
+    CHECK(lines.size() == 1);
+  }
+
+  // Many threads: every entry is either written or counted as dropped, and each thread's lines are in order
+  {
+    const int threads = 4, items = 20000;
+    captured c;
+    {
+      status_code_logger logger(captured::sink, &c, std::chrono::milliseconds(1));
+      std::vector<std::thread> ts;
+      for(int t = 0; t < threads; t++)
+      {
+        ts.emplace_back([&logger, t] {
+          for(int n = 0; n < items; n++)
+          {
+            logger.log("thread {} item {}", posix_code(EBUSY), t, n);
+          }
+        });
+      }
+      for(auto &t : ts)
+      {
+        t.join();
+      }
+      logger.flush();
+      const auto lines = c.lines();
+      CHECK(lines.size() + logger.dropped() == static_cast<size_t>(threads * items));
+      std::vector<int> last(threads, -1);
+      bool ordered = true;
+      for(const auto &line : lines)
+      {
+        int t = 0, n = 0;
+        const size_t at = line.find("thread ");
+        if(at == std::string::npos || sscanf(line.c_str() + at, "thread %d item %d", &t, &n) != 2 || t < 0 || t >= threads)
+        {
+          ordered = false;
+          continue;
+        }
+        ordered = ordered && n > last[t];
+        last[t] = n;
+      }
+      CHECK(ordered);
+    }
+  }
+
+  return retcode;
+}
@@ -0,0 +1,105 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status_code_prometheus.hpp"
+#include "status_code_ptr.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <string>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+static std::string render(SYSTEM_ERROR2_NAMESPACE::status_code_prometheus_exporter &exporter)
+{
+  std::string ret(exporter.render(nullptr, 0), 0);
+  if(!ret.empty())
+  {
+    exporter.render(&ret[0], ret.size());
+  }
+  return ret;
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  status_code_histogram histogram;
+  status_code_prometheus_exporter exporter(histogram);
+  const std::string header = "# HELP system_error2_status_codes_total Occurrences of status codes by domain and value.\n# TYPE system_error2_status_codes_total counter\n";
+  CHECK(render(exporter) == header);
+
+  const std::string enoent = "system_error2_status_codes_total{domain=\"posix domain\",errc=\"" + std::to_string(ENOENT) + "\",value=\"" + std::to_string(ENOENT) + "\"} ";
+  const std::string eacces = "system_error2_status_codes_total{domain=\"generic domain\",errc=\"" + std::to_string(EACCES) + "\",value=\"" + std::to_string(EACCES) + "\"} ";
+  histogram.record(posix_code(ENOENT));
+  histogram.record(posix_code(ENOENT));
+  histogram.record(generic_code(errc::permission_denied));
+  {
+    const std::string text = render(exporter);
+    CHECK(text.compare(0, header.size(), header) == 0);
+    CHECK(text.find(enoent + "2\n") != std::string::npos);
+    CHECK(text.find(eacces + "1\n") != std::string::npos);
+    CHECK(text.size() == header.size() + enoent.size() + 2 + eacces.size() + 2);
+  }
+
+  // Later renders update the counts, and codes whose value does not outlive them count as their generic code
+  histogram.record(posix_code(ENOENT));
+  histogram.record(make_status_code_ptr(generic_code(errc::permission_denied)));
+  {
+    const std::string text = render(exporter);
+    CHECK(text.find(enoent + "3\n") != std::string::npos);
+    CHECK(text.find(eacces + "2\n") != std::string::npos);
+  }
+
+  // Too small a buffer is not written to
+  {
+    char buffer[8] = {'x'};
+    CHECK(exporter.render(buffer, sizeof(buffer)) > sizeof(buffer));
+    CHECK(buffer[0] == 'x');
+  }
+
+  // Textfiles are written whole
+  {
+    const char *path = "test-status-code-prometheus.prom";
+    CHECK(exporter.write_textfile(path).success());
+    FILE *f = fopen(path, "rb");
+    CHECK(f != nullptr);
+    if(f != nullptr)
+    {
+      char buffer[1024];
+      const size_t len = fread(buffer, 1, sizeof(buffer), f);
+      fclose(f);
+      CHECK(std::string(buffer, len) == render(exporter));
+    }
+    remove(path);
+    CHECK(exporter.write_textfile("no/such/directory/file.prom") == errc::no_such_file_or_directory);
+  }
+  return retcode;
+}
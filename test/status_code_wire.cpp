@@ -0,0 +1,195 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "cancellation_code.hpp"
+#include "nt_code.hpp"
+#include "status_code_exact.hpp"
+#include "status_code_ptr.hpp"
+#include "status_code_wire.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+/* A domain whose values are indices into a per process table of names, so the
+value alone means nothing elsewhere. The name travels as the payload extension,
+and decoding finds or adds it to the receiving process' table.
+*/
+class _named_code_domain;
+using named_code = SYSTEM_ERROR2_NAMESPACE::status_code<_named_code_domain>;
+static const char *named_code_names[16] = {"first", "second"};
+
+class _named_code_domain : public SYSTEM_ERROR2_NAMESPACE::status_code_domain
+{
+  template <class DomainType> friend class SYSTEM_ERROR2_NAMESPACE::status_code;
+  using _base = SYSTEM_ERROR2_NAMESPACE::status_code_domain;
+  using status_code_void = SYSTEM_ERROR2_NAMESPACE::status_code<void>;
+
+public:
+  using value_type = intptr_t;
+  constexpr _named_code_domain() noexcept
+      : _base(0x0a61c3f95e2d7b48, _base::flag_trivially_erasable | _base::flag_has_wire_extension)
+  {
+  }
+  static inline constexpr const _named_code_domain &get();
+  virtual string_ref name() const noexcept override { return string_ref("named domain"); }
+
+protected:
+  virtual bool _do_failure(const status_code_void &code) const noexcept override { return static_cast<const named_code &>(code).value() != 0; }
+  virtual bool _do_equivalent(const status_code_void &code1, const status_code_void &code2) const noexcept override { return code2.domain() == *this && static_cast<const named_code &>(code1).value() == static_cast<const named_code &>(code2).value(); }
+  virtual SYSTEM_ERROR2_NAMESPACE::generic_code _generic_code(const status_code_void & /*unused*/) const noexcept override { return SYSTEM_ERROR2_NAMESPACE::errc::unknown; }
+  virtual string_ref _do_message(const status_code_void &code) const noexcept override { return string_ref(named_code_names[static_cast<const named_code &>(code).value()]); }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+  SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code_void &code) const override { throw SYSTEM_ERROR2_NAMESPACE::status_error<_named_code_domain>(static_cast<const named_code &>(code)); }
+#endif
+  virtual size_t _do_wire_extension(const status_code_void &code, void *buffer, size_t bytes) const noexcept override
+  {
+    const char *name = named_code_names[static_cast<const named_code &>(code).value()];
+    const size_t len = strlen(name);
+    if(len <= bytes)
+    {
+      memcpy(buffer, name, len);
+    }
+    return len;
+  }
+  virtual bool _do_wire_decode(status_code_void &dst, size_t bytes, intptr_t /*unused*/, const void *extension, size_t extension_bytes) const noexcept override
+  {
+    if(bytes < sizeof(named_code))
+    {
+      return false;
+    }
+    for(intptr_t n = 0; n < 16; n++)
+    {
+      if(named_code_names[n] != nullptr && strlen(named_code_names[n]) == extension_bytes && 0 == memcmp(named_code_names[n], extension, extension_bytes))
+      {
+        new(&dst) named_code(n);
+        return true;
+      }
+    }
+    return false;
+  }
+};
+constexpr _named_code_domain named_code_domain;
+SYSTEM_ERROR2_REGISTER_DOMAIN(named_code_domain);
+inline constexpr const _named_code_domain &_named_code_domain::get()
+{
+  return named_code_domain;
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+  exact_equal equal;
+
+  // Round trips
+  {
+    const system_code codes[] = {system_code(posix_code(EACCES)), system_code(generic_code(errc::timed_out)), system_code(make_status_code(cancellation_reason::superseded, 77)), system_code(nt_code(static_cast<win32::NTSTATUS>(0xC0000022))), system_code(posix_code(-1)), system_code(posix_code(200)), system_code()};
+    // Negative values take as few bytes as positive ones
+    const size_t sizes[] = {10, 10, 11, 13, 10, 11, 9};
+    for(size_t n = 0; n < sizeof(codes) / sizeof(codes[0]); n++)
+    {
+      unsigned char buffer[wire_encoded_max_size];
+      const size_t len = wire_encode(buffer, sizeof(buffer), codes[n]);
+      CHECK(len == sizes[n]);
+      system_code decoded;
+      size_t consumed = 0;
+      CHECK(wire_decode(decoded, consumed, buffer, len) == errc::success);
+      CHECK(consumed == len);
+      CHECK(equal(decoded, codes[n]));
+    }
+  }
+
+  // Codes whose value refers to state in this process cannot be encoded
+  {
+    unsigned char buffer[wire_encoded_max_size];
+    memset(buffer, 0xee, sizeof(buffer));
+    CHECK(wire_encode(buffer, sizeof(buffer), make_status_code_ptr(posix_code(EACCES))) == 0);
+    CHECK(buffer[0] == 0xee);
+  }
+
+  // Too small buffers and malformed input
+  {
+    unsigned char buffer[wire_encoded_max_size];
+    memset(buffer, 0xee, sizeof(buffer));
+    CHECK(wire_encode(buffer, 9, posix_code(EACCES)) == 10);
+    CHECK(buffer[0] == 0xee);
+    CHECK(wire_encode(buffer, sizeof(buffer), posix_code(EACCES)) == 10);
+    system_code decoded(generic_code(errc::invalid_argument));
+    size_t consumed = 1;
+    CHECK(wire_decode(decoded, consumed, buffer, 9) == errc::bad_message);
+    CHECK(decoded.empty());
+    CHECK(consumed == 0);
+    buffer[8] |= 0x80;
+    CHECK(wire_decode(decoded, consumed, buffer, 10) == errc::bad_message);
+    buffer[8] &= 0x7f;
+    buffer[0] ^= 0xff;
+    CHECK(wire_decode(decoded, consumed, buffer, 10) == errc::not_supported);
+  }
+
+  // Domains with a payload extension
+  {
+    unsigned char buffer[64];
+    const size_t len = wire_encode(buffer, sizeof(buffer), named_code(1));
+    CHECK(len == 9 + 1 + 2 + 6);
+    named_code_names[1] = nullptr;
+    named_code_names[5] = "second";
+    system_code decoded;
+    size_t consumed = 0;
+    CHECK(wire_decode(decoded, consumed, buffer, len) == errc::success);
+    CHECK(consumed == len);
+    CHECK(decoded.domain() == named_code_domain);
+    CHECK(!strcmp(decoded.message().c_str(), "second"));
+    CHECK(static_cast<const named_code &>(static_cast<const status_code<void> &>(decoded)).value() == 5);
+    CHECK(wire_decode(decoded, consumed, buffer, len - 1) == errc::bad_message);
+  }
+
+  // A stream of codes
+  {
+    unsigned char buffer[256];
+    size_t len = 0;
+    for(int n = 1; n <= 10; n++)
+    {
+      len += wire_encode(buffer + len, sizeof(buffer) - len, posix_code(n));
+    }
+    size_t offset = 0;
+    int n = 1;
+    while(offset < len)
+    {
+      system_code decoded;
+      size_t consumed = 0;
+      CHECK(wire_decode(decoded, consumed, buffer + offset, len - offset) == errc::success);
+      CHECK(equal(decoded, posix_code(n++)));
+      offset += consumed;
+    }
+    CHECK(n == 11);
+  }
+  return retcode;
+}
@@ -0,0 +1,132 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "nt_code.hpp"
+#include "status_code_ptr.hpp"
+#include "system_code.hpp"
+
+#include <cerrno>
+#include <cstdio>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+enum class BatchCode
+{
+  success,
+  busy,
+  gone,
+  unmapped
+};
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+template <> struct quick_status_code_from_enum<BatchCode> : quick_status_code_from_enum_defaults<BatchCode>
+{
+  static constexpr const auto domain_name = "Batch Code";
+  static constexpr const auto domain_uuid = "{3c9d51a7-6e08-4f2b-9a14-d7b0e28c5f63}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {BatchCode::success, "Success", {errc::success}},                                                        //
+    {BatchCode::busy, "Busy", {errc::device_or_resource_busy, errc::resource_unavailable_try_again}},      //
+    {BatchCode::gone, "Gone", {errc::no_such_file_or_directory}},                                           //
+    {BatchCode::unmapped, "Unmapped", {}},                                                                  //
+    };
+    return v;
+  }
+};
+SYSTEM_ERROR2_NAMESPACE_END
+using BatchCodeStatus = SYSTEM_ERROR2_NAMESPACE::quick_status_code_from_enum_code<BatchCode>;
+
+// Checks that the batch translation agrees with calling to_generic_code() on each code
+template <class Code, size_t N> static bool agrees(const Code (&codes)[N])
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  intptr_t values[N];
+  errc out[N];
+  for(size_t n = 0; n < N; n++)
+  {
+    values[n] = system_code(codes[n]).value();
+  }
+  codes[0].domain().to_generic_codes(out, values, N);
+  for(size_t n = 0; n < N; n++)
+  {
+    if(out[n] != codes[n].to_generic_code().value())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  {
+    const posix_code codes[] = {posix_code(0), posix_code(ENOENT), posix_code(EAGAIN), posix_code(EINTR), posix_code(ENOENT), posix_code(-1)};
+    CHECK(agrees(codes));
+    intptr_t values[] = {system_code(codes[1]).value(), system_code(codes[3]).value()};
+    errc out[2];
+    posix_code_domain.to_generic_codes(out, values, 2);
+    CHECK(out[0] == errc::no_such_file_or_directory);
+    CHECK(out[1] == errc::interrupted);
+  }
+  {
+    const generic_code codes[] = {generic_code(errc::success), generic_code(errc::permission_denied), generic_code(errc::unknown), generic_code(errc::timed_out)};
+    CHECK(agrees(codes));
+  }
+  {
+    const BatchCodeStatus codes[] = {BatchCode::success, BatchCode::busy, BatchCode::busy, BatchCode::gone, BatchCode::unmapped, BatchCode::busy};
+    CHECK(agrees(codes));
+    intptr_t values[] = {system_code(codes[1]).value(), system_code(codes[4]).value()};
+    errc out[2];
+    codes[0].domain().to_generic_codes(out, values, 2);
+    CHECK(out[0] == errc::device_or_resource_busy);
+    CHECK(out[1] == errc::unknown);
+  }
+
+  // Domains without an override use the scalar implementation
+  {
+    const nt_code codes[] = {nt_code(0), nt_code(static_cast<win32::NTSTATUS>(0xC0000034)), nt_code(static_cast<win32::NTSTATUS>(0xC0000022))};
+    CHECK(agrees(codes));
+  }
+
+  // Domains whose values are not the whole of the code cannot be translated from values
+  {
+    system_code sc = make_status_code_ptr(posix_code(EBUSY));
+    intptr_t value = sc.value();
+    errc out = errc::success;
+    sc.domain().to_generic_codes(&out, &value, 1);
+    CHECK(out == errc::unknown);
+  }
+
+  // Zero values is fine
+  posix_code_domain.to_generic_codes(nullptr, nullptr, 0);
+  return retcode;
+}
@@ -0,0 +1,108 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "detail/win32_code_tables.hpp"
+
+#include <cstdio>
+
+#define CHECK(expr)                                                                                                                                                                                                                                                                                                            \
+  if(!(expr))                                                                                                                                                                                                                                                                                                                  \
+  {                                                                                                                                                                                                                                                                                                                            \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                                                                                                                                                                                                                                   \
+    retcode = 1;                                                                                                                                                                                                                                                                                                               \
+  }
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  // The tables must be strictly sorted for the binary search to work
+  {
+    const auto &t1 = detail::win32_code_tables<>::nt_code_to_win32_code;
+    const auto &t2 = detail::win32_code_tables<>::nt_code_to_generic_code;
+    const auto &t3 = detail::win32_code_tables<>::win32_code_to_generic_code;
+    bool sorted = true;
+    for(size_t n = 1; n < sizeof(t1) / sizeof(t1[0]); n++)
+      sorted = sorted && t1[n - 1].from < t1[n].from;
+    for(size_t n = 1; n < sizeof(t2) / sizeof(t2[0]); n++)
+      sorted = sorted && t2[n - 1].from < t2[n].from;
+    for(size_t n = 1; n < sizeof(t3) / sizeof(t3[0]); n++)
+      sorted = sorted && t3[n - 1].from < t3[n].from;
+    CHECK(sorted);
+    printf("NT to Win32 table has %zu entries, NT to POSIX %zu, Win32 to POSIX %zu, totalling %zu bytes\n", sizeof(t1) / sizeof(t1[0]), sizeof(t2) / sizeof(t2[0]), sizeof(t3) / sizeof(t3[0]), sizeof(t1) + sizeof(t2) + sizeof(t3));
+
+    // Every entry must be findable, including the first and last
+    bool found = true;
+    for(auto &i : t1)
+      found = found && detail::nt_code_to_win32_code(i.from) == i.to;
+    for(auto &i : t2)
+      found = found && detail::nt_code_to_errno(i.from) == static_cast<int>(i.to);
+    for(auto &i : t3)
+      found = found && detail::win32_code_to_errno(i.from) == static_cast<int>(i.to);
+    CHECK(found);
+  }
+
+  // Known mappings
+  CHECK(detail::nt_code_to_errno(0xC0000022 /*STATUS_ACCESS_DENIED*/) == EACCES);
+  CHECK(detail::nt_code_to_win32_code(0xC0000022 /*STATUS_ACCESS_DENIED*/) == 0x5 /*ERROR_ACCESS_DENIED*/);
+  CHECK(detail::nt_code_to_errno(0xC0000034 /*STATUS_OBJECT_NAME_NOT_FOUND*/) == ENOENT);
+  CHECK(detail::nt_code_to_win32_code(0xC0000034 /*STATUS_OBJECT_NAME_NOT_FOUND*/) == 0x2 /*ERROR_FILE_NOT_FOUND*/);
+  CHECK(detail::win32_code_to_errno(0x5 /*ERROR_ACCESS_DENIED*/) == EACCES);
+  CHECK(detail::win32_code_to_errno(0x57 /*ERROR_INVALID_PARAMETER*/) == EINVAL);
+
+  // Unknown mappings, including either side of the table bounds
+  CHECK(detail::nt_code_to_errno(0) == -1);
+  CHECK(detail::nt_code_to_errno(0xFFFFFFFF) == -1);
+  CHECK(detail::nt_code_to_win32_code(0x80000001) == static_cast<uint32_t>(-1));
+  CHECK(detail::win32_code_to_errno(0) == -1);
+  CHECK(detail::win32_code_to_errno(0x7 /*ERROR_ARENA_TRASHED*/) == -1);
+  CHECK(detail::win32_code_to_errno(0xFFFFFFFF) == -1);
+
+  // The message tables must also be strictly sorted, and every entry findable
+  {
+    const auto &t1 = detail::win32_code_tables<>::nt_code_messages;
+    const auto &t2 = detail::win32_code_tables<>::win32_code_messages;
+    const auto &t3 = detail::win32_code_tables<>::com_code_messages;
+    bool sorted = true, found = true;
+    for(size_t n = 1; n < sizeof(t1) / sizeof(t1[0]); n++)
+      sorted = sorted && t1[n - 1].from < t1[n].from;
+    for(size_t n = 1; n < sizeof(t2) / sizeof(t2[0]); n++)
+      sorted = sorted && t2[n - 1].from < t2[n].from;
+    for(size_t n = 1; n < sizeof(t3) / sizeof(t3[0]); n++)
+      sorted = sorted && t3[n - 1].from < t3[n].from;
+    for(auto &i : t1)
+      found = found && detail::nt_code_message(i.from) == i.message;
+    for(auto &i : t2)
+      found = found && detail::win32_code_message(i.from) == i.message;
+    for(auto &i : t3)
+      found = found && detail::com_code_message(i.from) == i.message;
+    CHECK(sorted);
+    CHECK(found);
+    CHECK(detail::win32_code_message(0x7 /*ERROR_ARENA_TRASHED*/) == nullptr);
+    CHECK(detail::com_code_message(0x80070005 /*E_ACCESSDENIED, in FACILITY_WIN32*/) == nullptr);
+  }
+
+  return retcode;
+}
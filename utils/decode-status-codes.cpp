@@ -0,0 +1,534 @@
+/* Decode binary records of status codes into text
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (5 commits)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "cancellation_code.hpp"
+#include "com_code.hpp"
+#include "getaddrinfo_code.hpp"
+#include "nt_code.hpp"
+#include "packed_status_code.hpp"
+#include "portable_status_code.hpp"
+#include "status_code_journal.hpp"
+#include "status_code_json.hpp"
+#include "status_code_wire.hpp"
+#include "win32_code.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* This program renders status codes recorded in binary, by domain id and
+value, into text. It reads segment files written by `status_code_journal`,
+streams of `wire_encode()` encodings, or streams of the 64 bit words of
+`packed_status_code` in little endian byte order, and writes one line per
+code as text, CSV or JSON lines.
+
+Domains are looked up in `status_code_domain_registry`, which holds all the
+built-in domains. To decode codes of your own domains, build this file into
+an executable along with a translation unit registering your domains with
+`SYSTEM_ERROR2_REGISTER_DOMAIN()`. Packed codes refer to domains by index,
+which is fixed for the built-in domains. Indices of other domains are looked
+up in the file given by `--dictionary`, holding the little endian 64 bit ids of
+the `packed_status_code_dictionary` the codes were packed with.
+
+Input is processed in chunks of many records, each split between threads
+which render their share, and the results written out in order. Rendered
+codes are cached per thread, as recorded codes are usually a few codes
+repeated many times.
+
+Usage: decode-status-codes [--journal | --wire | --packed [--dictionary file]] [--format text|csv|json] [--threads N] [file ...]
+
+The input format defaults to `--journal`. A file of `-`, or no files, reads
+standard input. Empty codes are skipped.
+*/
+
+namespace se2 = SYSTEM_ERROR2_NAMESPACE;
+
+enum class input_format
+{
+  journal,
+  wire,
+  packed
+};
+enum class output_format
+{
+  text,
+  csv,
+  json
+};
+
+// One record as split from the input, before rendering
+struct record
+{
+  input_format kind;
+  uint64_t timestamp, thread, site;  // journal records only
+  uint64_t domain_id;                // the domain index for packed records
+  int64_t value;                     // the packed bits for packed records
+  const unsigned char *wire;         // the encoding, for wire records
+  size_t wire_bytes;
+};
+
+static uint64_t read_le64(const unsigned char *p)
+{
+  uint64_t ret = 0;
+  for(int n = 0; n < 8; n++)
+  {
+    ret |= static_cast<uint64_t>(p[n]) << (n * 8);
+  }
+  return ret;
+}
+
+static void append_csv_field(std::string &out, const char *s, size_t len)
+{
+  out.push_back('"');
+  for(size_t n = 0; n < len; n++)
+  {
+    if(s[n] == '"')
+    {
+      out.push_back('"');
+    }
+    out.push_back(s[n]);
+  }
+  out.push_back('"');
+}
+
+static void append_timestamp(std::string &out, uint64_t ns)
+{
+  const auto secs = static_cast<time_t>(ns / 1000000000);
+  struct tm t;
+#ifdef _WIN32
+  gmtime_s(&t, &secs);
+#else
+  gmtime_r(&secs, &t);
+#endif
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%09uZ", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec, static_cast<unsigned>(ns % 1000000000));
+  out.append(buffer);
+}
+
+// Renders records, caching the rendering of each code
+class renderer
+{
+  output_format _format;
+  const se2::packed_status_code_dictionary *_dictionary;
+  std::unordered_map<uint64_t, std::unordered_map<int64_t, std::string>> _cache;
+
+  // Renders the code part of a line
+  void _render_code(std::string &out, const record &r) const
+  {
+    se2::system_code code;
+    int64_t value = r.value;
+    switch(r.kind)
+    {
+    case input_format::journal:
+      code = se2::portable_status_code(r.domain_id, r.value).to_system_code();
+      break;
+    case input_format::wire:
+    {
+      size_t consumed;
+      se2::wire_decode(code, consumed, r.wire, r.wire_bytes);
+      break;
+    }
+    case input_format::packed:
+    {
+      const auto packed = se2::packed_status_code::from_bits(static_cast<uint64_t>(r.value));
+      code = packed.to_system_code(*_dictionary);
+      value = packed.value();
+      break;
+    }
+    }
+    char buffer[96];
+    if(code.empty())
+    {
+      // Packed records of domains not in the dictionary only have an index
+      uint64_t domain_id = r.domain_id;
+      if(r.kind == input_format::packed)
+      {
+        domain_id = _dictionary->id_of(static_cast<uint16_t>(r.domain_id));
+      }
+      char id[32];
+      if(domain_id == 0)
+      {
+        snprintf(id, sizeof(id), "index %llu", static_cast<unsigned long long>(r.domain_id));
+      }
+      else
+      {
+        snprintf(id, sizeof(id), "0x%016llx", static_cast<unsigned long long>(domain_id));
+      }
+      switch(_format)
+      {
+      case output_format::text:
+        snprintf(buffer, sizeof(buffer), "unknown domain %s: %lld", id, static_cast<long long>(value));
+        break;
+      case output_format::csv:
+        snprintf(buffer, sizeof(buffer), "\"%s\",,%lld,,", id, static_cast<long long>(value));
+        break;
+      case output_format::json:
+        snprintf(buffer, sizeof(buffer), "{\"id\":\"%s\",\"value\":%lld}", id, static_cast<long long>(value));
+        break;
+      }
+      out.append(buffer);
+      return;
+    }
+    const auto name = code.domain().name();
+    const auto msg = code.message();
+    switch(_format)
+    {
+    case output_format::text:
+      out.append(name.data(), name.size()).append(": ").append(msg.data(), msg.size());
+      snprintf(buffer, sizeof(buffer), " (%lld)", static_cast<long long>(code.value()));
+      out.append(buffer);
+      break;
+    case output_format::csv:
+      snprintf(buffer, sizeof(buffer), "\"0x%016llx\",", static_cast<unsigned long long>(code.domain().id()));
+      out.append(buffer);
+      append_csv_field(out, name.data(), name.size());
+      snprintf(buffer, sizeof(buffer), ",%lld,%d,", static_cast<long long>(code.value()), static_cast<int>(code.to_generic_code().value()));
+      out.append(buffer);
+      append_csv_field(out, msg.data(), msg.size());
+      break;
+    case output_format::json:
+    {
+      const size_t offset = out.size();
+      out.resize(offset + 256);
+      size_t len = se2::json_encode(&out[offset], 256, code);
+      if(len > 256)
+      {
+        out.resize(offset + len);
+        len = se2::json_encode(&out[offset], len, code);
+      }
+      out.resize(offset + len);
+      break;
+    }
+    }
+  }
+
+public:
+  renderer(output_format format, const se2::packed_status_code_dictionary &dictionary)
+      : _format(format)
+      , _dictionary(&dictionary)
+  {
+  }
+
+  void render(std::string &out, const record &r)
+  {
+    char buffer[96];
+    const bool has_metadata = (r.kind == input_format::journal);
+    if(has_metadata)
+    {
+      switch(_format)
+      {
+      case output_format::text:
+        append_timestamp(out, r.timestamp);
+        snprintf(buffer, sizeof(buffer), " thread %llu site %llu ", static_cast<unsigned long long>(r.thread), static_cast<unsigned long long>(r.site));
+        break;
+      case output_format::csv:
+        out.push_back('"');
+        append_timestamp(out, r.timestamp);
+        snprintf(buffer, sizeof(buffer), "\",%llu,%llu,", static_cast<unsigned long long>(r.thread), static_cast<unsigned long long>(r.site));
+        break;
+      case output_format::json:
+        snprintf(buffer, sizeof(buffer), "{\"timestamp\":%llu,\"thread\":%llu,\"site\":%llu,\"code\":", static_cast<unsigned long long>(r.timestamp), static_cast<unsigned long long>(r.thread), static_cast<unsigned long long>(r.site));
+        break;
+      }
+      out.append(buffer);
+    }
+    else if(_format == output_format::csv)
+    {
+      out.append(",,,");
+    }
+    // Codes with a payload extension are not identified by domain id and value alone
+    const bool cacheable = r.kind != input_format::wire || (r.wire[8] & 0x10) == 0;
+    if(cacheable)
+    {
+      std::string &cached = _cache[r.domain_id][r.value];
+      if(cached.empty())
+      {
+        _render_code(cached, r);
+      }
+      out.append(cached);
+    }
+    else
+    {
+      _render_code(out, r);
+    }
+    if(has_metadata && _format == output_format::json)
+    {
+      out.push_back('}');
+    }
+    out.push_back('\n');
+  }
+};
+
+/* Splits `bytes` at `p` into records, returning the number of bytes used.
+Bytes of an incomplete record at the end are left for the next chunk.
+*/
+static size_t split_records(std::vector<record> &out, input_format format, const unsigned char *p, size_t bytes, bool &bad)
+{
+  size_t used = 0;
+  switch(format)
+  {
+  case input_format::journal:
+    for(; bytes - used >= sizeof(se2::status_code_journal_record); used += sizeof(se2::status_code_journal_record))
+    {
+      se2::status_code_journal_record r;
+      memcpy(&r, p + used, sizeof(r));
+      if(r.committed != 0)
+      {
+        out.push_back(record{input_format::journal, r.timestamp, r.thread, r.site, r.domain_id, r.value, nullptr, 0});
+      }
+    }
+    break;
+  case input_format::packed:
+    for(; bytes - used >= 8; used += 8)
+    {
+      const uint64_t bits = read_le64(p + used);
+      if(bits == 0)
+      {
+        continue;  // empty code
+      }
+      out.push_back(record{input_format::packed, 0, 0, 0, bits >> 48, static_cast<int64_t>(bits), nullptr, 0});
+    }
+    break;
+  case input_format::wire:
+    while(bytes - used >= 9)
+    {
+      const unsigned char *q = p + used;
+      const unsigned value_bytes = q[8] & 0xf;
+      if(value_bytes > 8 || (q[8] & ~0x1fU) != 0)
+      {
+        bad = true;
+        return used;
+      }
+      size_t len = 9 + value_bytes;
+      if((q[8] & 0x10) != 0)
+      {
+        if(bytes - used < len + 2)
+        {
+          break;
+        }
+        len += 2 + (static_cast<size_t>(q[len]) | (static_cast<size_t>(q[len + 1]) << 8));
+      }
+      if(bytes - used < len)
+      {
+        break;
+      }
+      uint64_t value = 0;
+      for(unsigned n = 0; n < value_bytes; n++)
+      {
+        value |= static_cast<uint64_t>(q[9 + n]) << (n * 8);
+      }
+      if(read_le64(q) != 0)  // else an empty code
+      {
+        out.push_back(record{input_format::wire, 0, 0, 0, read_le64(q), se2::detail::wire_codec::sign_extend(value, value_bytes), q, len});
+      }
+      used += len;
+    }
+    break;
+  }
+  return used;
+}
+
+static bool decode_stream(std::istream &in, const char *name, input_format format, output_format oformat, const se2::packed_status_code_dictionary &dictionary, unsigned threads)
+{
+  static const size_t chunk_bytes = 16 * 1024 * 1024;
+  std::vector<unsigned char> buffer(chunk_bytes);
+  std::vector<record> records;
+  std::vector<std::string> outputs(threads);
+  std::vector<renderer> renderers(threads, renderer(oformat, dictionary));
+  size_t have = 0;
+  if(format == input_format::journal)
+  {
+    se2::status_code_journal_header header;
+    if(!in.read(reinterpret_cast<char *>(&header), sizeof(header)) || memcmp(header.magic, "se2jrnl", 8) != 0 || header.record_size != sizeof(se2::status_code_journal_record))
+    {
+      std::cerr << "FATAL: " << name << " is not a status code journal segment" << std::endl;
+      return false;
+    }
+  }
+  for(;;)
+  {
+    in.read(reinterpret_cast<char *>(buffer.data() + have), static_cast<std::streamsize>(buffer.size() - have));
+    const auto got = static_cast<size_t>(in.gcount());
+    have += got;
+    records.clear();
+    bool bad = false;
+    const size_t used = split_records(records, format, buffer.data(), have, bad);
+    if(bad)
+    {
+      std::cerr << "FATAL: " << name << " contains a malformed wire encoding" << std::endl;
+      return false;
+    }
+    // Render a share of the records on each thread, then write them out in order
+    std::vector<std::thread> workers;
+    const size_t per_thread = (records.size() + threads - 1) / threads;
+    for(unsigned t = 0; t < threads; t++)
+    {
+      const size_t begin = std::min(records.size(), t * per_thread), end = std::min(records.size(), begin + per_thread);
+      outputs[t].clear();
+      auto work = [&, t, begin, end] {
+        for(size_t n = begin; n < end; n++)
+        {
+          renderers[t].render(outputs[t], records[n]);
+        }
+      };
+      if(t + 1 == threads || end - begin < 1024)
+      {
+        work();
+      }
+      else
+      {
+        workers.emplace_back(work);
+      }
+    }
+    for(auto &w : workers)
+    {
+      w.join();
+    }
+    for(const auto &o : outputs)
+    {
+      std::cout.write(o.data(), static_cast<std::streamsize>(o.size()));
+    }
+    memmove(buffer.data(), buffer.data() + used, have - used);
+    have -= used;
+    if(got == 0)
+    {
+      break;
+    }
+    if(have == buffer.size())
+    {
+      // A single record larger than the buffer
+      buffer.resize(buffer.size() * 2);
+    }
+  }
+  if(have != 0 && format != input_format::journal)
+  {
+    std::cerr << "WARNING: " << name << " ends with " << have << " bytes of an incomplete record" << std::endl;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  input_format format = input_format::journal;
+  output_format oformat = output_format::text;
+  unsigned threads = std::max(1U, std::thread::hardware_concurrency());
+  std::vector<std::string> files;
+  const char *dictionary_file = nullptr;
+  for(int n = 1; n < argc; n++)
+  {
+    if(0 == strcmp(argv[n], "--journal"))
+      format = input_format::journal;
+    else if(0 == strcmp(argv[n], "--wire"))
+      format = input_format::wire;
+    else if(0 == strcmp(argv[n], "--packed"))
+      format = input_format::packed;
+    else if(0 == strcmp(argv[n], "--dictionary") && n + 1 < argc)
+      dictionary_file = argv[++n];
+    else if(0 == strcmp(argv[n], "--format") && n + 1 < argc)
+    {
+      ++n;
+      if(0 == strcmp(argv[n], "text"))
+        oformat = output_format::text;
+      else if(0 == strcmp(argv[n], "csv"))
+        oformat = output_format::csv;
+      else if(0 == strcmp(argv[n], "json"))
+        oformat = output_format::json;
+      else
+      {
+        std::cerr << "FATAL: Unknown output format " << argv[n] << std::endl;
+        return 1;
+      }
+    }
+    else if(0 == strcmp(argv[n], "--threads") && n + 1 < argc)
+      threads = std::max(1, atoi(argv[++n]));
+    else if(argv[n][0] == '-' && argv[n][1] == '-')
+    {
+      std::cerr << "Usage: " << argv[0] << " [--journal | --wire | --packed [--dictionary file]] [--format text|csv|json] [--threads N] [file ...]" << std::endl;
+      return 1;
+    }
+    else
+      files.push_back(argv[n]);
+  }
+  if(files.empty())
+  {
+    files.push_back("-");
+  }
+  se2::packed_status_code_dictionary dictionary;
+  if(dictionary_file != nullptr)
+  {
+    std::ifstream in(dictionary_file, std::ios::binary);
+    if(!in)
+    {
+      std::cerr << "FATAL: Could not open " << dictionary_file << std::endl;
+      return 1;
+    }
+    std::vector<se2::packed_status_code_dictionary::unique_id_type> ids;
+    unsigned char buffer[8];
+    while(in.read(reinterpret_cast<char *>(buffer), sizeof(buffer)))
+    {
+      ids.push_back(read_le64(buffer));
+    }
+    if(!in.eof() || in.gcount() != 0)
+    {
+      std::cerr << "FATAL: " << dictionary_file << " is not a packed status code dictionary" << std::endl;
+      return 1;
+    }
+    dictionary = se2::packed_status_code_dictionary(ids.data(), ids.size());
+  }
+  std::ios::sync_with_stdio(false);
+  if(oformat == output_format::csv)
+  {
+    std::cout << "timestamp,thread,site,domain_id,domain,value,errc,message\n";
+  }
+  for(const auto &file : files)
+  {
+    if(file == "-")
+    {
+      if(!decode_stream(std::cin, "standard input", format, oformat, dictionary, threads))
+      {
+        return 1;
+      }
+      continue;
+    }
+    std::ifstream in(file, std::ios::binary);
+    if(!in)
+    {
+      std::cerr << "FATAL: Could not open " << file << std::endl;
+      return 1;
+    }
+    if(!decode_stream(in, file.c_str(), format, oformat, dictionary, threads))
+    {
+      return 1;
+    }
+  }
+  std::cout.flush();
+  return std::cout ? 0 : 1;
+}
@@ -22,12 +22,36 @@ Distributed under the Boost Software License, Version 1.0.
 http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#ifdef _WIN32
-#include <Windows.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <system_error>
+#include <sstream>
+#include <string>
 #include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <system_error>
+#endif
+
+/* This program has two halves. On Windows only, `--from-system` interrogates
+the running system for how it maps NT kernel codes to Win32 codes, and how
+the Microsoft STL maps Win32 codes onto `std::errc`, writing the results as
+plain text into utils/data. On every platform, the checked in text in
+utils/data is then sorted, validated and written out as the constexpr array
+initialisers in include/detail which `detail::win32_code_tables` includes.
+The message tables used on platforms without `FormatMessage()` are
+maintained by hand in utils/data, and are never touched by `--from-system`.
+
+`--verify` regenerates the tables in memory and fails if they differ from
+the ones in include/detail, which is how the test suite checks that the two
+have not drifted.
+
+Usage: generate-tables [source root, default ..] [--verify] [--from-system]
+*/
 
 /* NTSTATUS (LONG) bit format:
 //           27                   16 15                            0
@@ -143,6 +167,49 @@ static constexpr std::pair<int, const char *> posixmap[] = {
 };
 // clang-format on
 
+// Of the above, these are not POSIX, so cannot appear in the tables
+static inline bool is_portable_errno_name(const std::string &name)
+{
+  if(name == "STRUNCATE" || name == "EOTHER")
+  {
+    return false;
+  }
+  for(auto &p : posixmap)
+  {
+    if(name == p.second)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct table_entry
+{
+  uint32_t from;
+  std::string to;
+};
+
+struct table_description
+{
+  const char *name;
+  enum
+  {
+    win32_code,  // a 16 bit hexadecimal Win32 code
+    errno_name,  // a POSIX errno name
+    message      // the remainder of the line is a message string
+  } to;
+};
+static constexpr table_description tables[] = {
+{"nt_code_to_win32_code", table_description::win32_code},       //
+{"nt_code_to_generic_code", table_description::errno_name},     //
+{"win32_code_to_generic_code", table_description::errno_name},  //
+{"nt_code_messages", table_description::message},               //
+{"win32_code_messages", table_description::message},            //
+{"com_code_messages", table_description::message}               //
+};
+
+#ifdef _WIN32
 static constexpr std::pair<NTSTATUS, NTSTATUS> inputs[] = {
 //
 //{0x00000000L, 0x0000ffffL},  //
@@ -170,10 +237,15 @@ static inline DWORD win32_error_from_nt_status(NTSTATUS ntstatus)
   return GetLastError();
 }
 
-int main()
+static bool generate_source_data(const std::string &root)
 {
-  std::ofstream nt_win32("../include/detail/nt_code_to_win32_code.ipp");
-  std::ofstream nt_generic("../include/detail/nt_code_to_generic_code.ipp");
+  std::ofstream nt_win32(root + "/utils/data/nt_code_to_win32_code.txt");
+  std::ofstream nt_generic(root + "/utils/data/nt_code_to_generic_code.txt");
+  if(!nt_win32 || !nt_generic)
+  {
+    std::cerr << "FATAL: Could not open " << root << "/utils/data for writing" << std::endl;
+    return false;
+  }
   for(auto &input : inputs)
   {
     for(NTSTATUS code = input.first; code < input.second; code++)
@@ -195,14 +267,14 @@ int main()
           }
         }
         if(win32code < 0xffff)
-          nt_win32 << "case 0x" << std::hex << (unsigned) code << ": return 0x" << win32code << ";\n";
-        if(errc[0] != '0')
-          nt_generic << "case 0x" << std::hex << (unsigned) code << ": return " << errc << ";\n";
+          nt_win32 << "0x" << std::hex << (unsigned) code << " 0x" << win32code << "\n";
+        if(errc[0] != '0' && is_portable_errno_name(errc))
+          nt_generic << "0x" << std::hex << (unsigned) code << " " << errc << "\n";
       }
     }
   }
 
-  std::ofstream win32_generic("../include/detail/win32_code_to_generic_code.ipp");
+  std::ofstream win32_generic(root + "/utils/data/win32_code_to_generic_code.txt");
   for(DWORD win32code = 0; win32code <= 0xffff; win32code++)
   {
     std::error_code ec(win32code, std::system_category());
@@ -216,18 +288,164 @@ int main()
           errc = p.second;
       }
     }
-    if(errc[0] != '0')
-      win32_generic << "case 0x" << std::hex << win32code << ": return " << errc << ";\n";
+    if(errc[0] != '0' && is_portable_errno_name(errc))
+      win32_generic << "0x" << std::hex << win32code << " " << errc << "\n";
     /* Omissions from the C++ 11 STL mapping */
     else if(win32code == 0x57 /*ERROR_INVALID_PARAMETER*/)
-      win32_generic << "case 0x" << std::hex << win32code << ": return EINVAL;\n";
+      win32_generic << "0x" << std::hex << win32code << " EINVAL\n";
   }
+  return true;
 }
+#endif
 
-#else
-int main()
+// Reads one table of source data, returning false if it is malformed
+static bool read_source_data(const std::string &path, const table_description &desc, std::vector<table_entry> &entries)
+{
+  std::ifstream in(path);
+  if(!in)
+  {
+    std::cerr << "FATAL: Could not open " << path << std::endl;
+    return false;
+  }
+  std::string line;
+  for(size_t lineno = 1; std::getline(in, line); lineno++)
+  {
+    if(line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+    std::istringstream s(line);
+    std::string from, to;
+    s >> from;
+    if(desc.to == table_description::message)
+    {
+      std::getline(s >> std::ws, to);
+    }
+    else
+    {
+      s >> to;
+    }
+    char *end = nullptr;
+    unsigned long v = (from.size() > 2 && from.compare(0, 2, "0x") == 0) ? strtoul(from.c_str() + 2, &end, 16) : 0;
+    bool valid = (end != nullptr && *end == 0 && v <= 0xffffffffUL);
+    if(valid && desc.to == table_description::message)
+    {
+      valid = !to.empty();
+    }
+    else if(valid && desc.to == table_description::errno_name)
+    {
+      valid = is_portable_errno_name(to);
+    }
+    else if(valid)
+    {
+      char *end2 = nullptr;
+      unsigned long w = (to.size() > 2 && to.compare(0, 2, "0x") == 0) ? strtoul(to.c_str() + 2, &end2, 16) : 0;
+      valid = (end2 != nullptr && *end2 == 0 && w != 0 && w < 0xffff);
+    }
+    if(!valid)
+    {
+      std::cerr << "FATAL: " << path << ":" << lineno << " is not a valid mapping: " << line << std::endl;
+      return false;
+    }
+    entries.push_back(table_entry{static_cast<uint32_t>(v), to});
+  }
+  std::stable_sort(entries.begin(), entries.end(), [](const table_entry &a, const table_entry &b) { return a.from < b.from; });
+  for(size_t n = 1; n < entries.size(); n++)
+  {
+    if(entries[n - 1].from == entries[n].from)
+    {
+      std::cerr << "FATAL: " << path << " maps 0x" << std::hex << entries[n].from << " more than once" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Renders a table as the body of a sorted constexpr array initialiser
+static std::string render_table(const table_description &desc, const std::vector<table_entry> &entries)
+{
+  std::ostringstream out;
+  out << "// Generated by utils/generate-tables.cpp from utils/data/" << desc.name << ".txt, do not edit\n";
+  for(auto &entry : entries)
+  {
+    out << "{0x" << std::hex << entry.from << ", ";
+    if(desc.to == table_description::message)
+    {
+      out << '"';
+      for(char c : entry.to)
+      {
+        if(c == '"' || c == '\\')
+        {
+          out << '\\';
+        }
+        out << c;
+      }
+      out << '"';
+    }
+    else
+    {
+      out << entry.to;
+    }
+    out << "},\n";
+  }
+  return out.str();
+}
+
+int main(int argc, char *argv[])
 {
-  std::cerr << "This program can only work on Windows" << std::endl;
-  return 1;
+  std::string root("..");
+  bool verify = false, from_system = false;
+  for(int n = 1; n < argc; n++)
+  {
+    if(0 == strcmp(argv[n], "--verify"))
+      verify = true;
+    else if(0 == strcmp(argv[n], "--from-system"))
+      from_system = true;
+    else
+      root = argv[n];
+  }
+  if(from_system)
+  {
+#ifdef _WIN32
+    if(!generate_source_data(root))
+    {
+      return 1;
+    }
+#else
+    std::cerr << "FATAL: --from-system can only work on Windows" << std::endl;
+    return 1;
+#endif
+  }
+  int ret = 0;
+  for(auto &desc : tables)
+  {
+    std::vector<table_entry> entries;
+    if(!read_source_data(root + "/utils/data/" + desc.name + ".txt", desc, entries))
+    {
+      return 1;
+    }
+    const std::string rendered = render_table(desc, entries), path = root + "/include/detail/" + desc.name + ".ipp";
+    if(verify)
+    {
+      std::ifstream in(path, std::ios::binary);
+      std::ostringstream existing;
+      existing << in.rdbuf();
+      std::string contents(existing.str());
+      contents.erase(std::remove(contents.begin(), contents.end(), '\r'), contents.end());  // in case of CRLF checkouts
+      if(contents != rendered)
+      {
+        std::cerr << path << " differs from what utils/data/" << desc.name << ".txt generates, rerun generate-tables" << std::endl;
+        ret = 1;
+      }
+      continue;
+    }
+    std::ofstream out(path, std::ios::binary);
+    out << rendered;
+    if(!out)
+    {
+      std::cerr << "FATAL: Could not write " << path << std::endl;
+      return 1;
+    }
+  }
+  return ret;
 }
-#endif
\ No newline at end of file